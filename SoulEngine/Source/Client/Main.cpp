@@ -11,12 +11,16 @@ Entry point for the Client side of this app.
 #include <UtilsLib/Macros.h>
 #include <UtilsLib/Logger.h>
 #include <UtilsLib/Timer.h>
+#include <UtilsLib/UsageProfile.h>
 
 #include <TestsLib/TestRunner.h>
 
 void StartUp();
 void ShutDown();
 
+// Peak usage from the previous run, used to size the engine's systems.
+const char* UsageProfilePath = "Data/UsageProfile.bin";
+
 int main()
 {
 	Soul::Timer timer;
@@ -39,12 +43,20 @@ int main()
 
 void StartUp()
 {
-	Soul::MemoryManager::StartUp(Gigabytes(1), Megabytes(8));
-	Soul::EventBus::StartUp(32);
+	Soul::UsageProfile usageProfile;
+	usageProfile.Load(UsageProfilePath);
+
+	Soul::MemoryManager::StartUp(usageProfile.GetArenaByteSize(),
+		usageProfile.GetVolatileByteSize(), usageProfile.GetHandleTableLength());
+	Soul::EventBus::StartUp(usageProfile.GetEventCount());
 }
 
 void ShutDown()
 {
+	Soul::UsageProfile usageProfile;
+	usageProfile.Capture();
+	usageProfile.Save(UsageProfilePath);
+
 	Soul::EventBus::Shutdown();
 
 	Assert(Soul::MemoryManager::GetTotalAllocatedBytes() == 0);
@@ -2,33 +2,52 @@
 Transfers events to all registered event listeners in queue order.
 @file EventBus.h
 @author Jacob Peterson
-@edited 4/18/21
+@edited 10/19/26
 */
 
 #include "EventBus.h"
 
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
 #include <UtilsLib/Logger.h>
 
 namespace Soul
 {
-	UniqueHandle<Queue<Event>> EventBus::m_EventQueue;
-	UniqueHandle<Vector<Callback>> EventBus::m_RegisteredCallbacks;
+	UniqueHandle<EventStream> EventBus::m_EventStream;
+	std::atomic<EventStagingRing*> EventBus::m_StagingRings[EventBus::MaxProducerThreads];
+	std::atomic<bool> EventBus::m_ProducerClaims[EventBus::MaxProducerThreads];
+	thread_local EventStagingRing* EventBus::m_ProducerRing = nullptr;
+	thread_local UInt32 EventBus::m_ProducerIndex = 0;
+	std::thread::id EventBus::m_DispatchThread;
+	UniqueHandle<CallbackList> EventBus::m_RegisteredCallbacks;
+	UniqueHandle<Byte> EventBus::m_WorkerPoolMemory;
+	WorkerPool* EventBus::m_WorkerPool = nullptr;
+	UniqueHandle<Vector<void*>> EventBus::m_BatchEvents;
+	UniqueHandle<ArraySize> EventBus::m_BatchOffsets;
+	UniqueHandle<Vector<EventBus::ParallelJob>> EventBus::m_ParallelJobs;
 	CallbackId EventBus::m_CallbackCount = 0;
+	ArraySize EventBus::m_PeakEventCount = 0;
 	bool EventBus::m_IsSetup = false;
 
 	void EventBus::StartUp(ArraySize eventCount)
 	{
 		Assert(!m_IsSetup);
-		m_EventQueue = MemoryManager::Allocate<Queue<Event>>(eventCount);
+		m_DispatchThread = std::this_thread::get_id();
+		// Most events carry a pointer or a small payload, about 16 bytes each.
+		m_EventStream = MemoryManager::Allocate<EventStream>(eventCount * 16);
+
 		m_RegisteredCallbacks =
-			MemoryManager::AllocateArray<Vector<Callback>>((ArraySize)Events::EventTotal);
-		m_RegisteredCallbacks.SetImmovable(true);
+			MemoryManager::AllocateArray<CallbackList>((ArraySize)Events::EventTotal);
+		m_PeakEventCount = 0;
 
-		for (ArraySize i = 0; i < (ArraySize)Events::EventTotal; ++i)
-		{
-			Vector<Callback> vec(4);
-			m_RegisteredCallbacks[i] = std::move(vec);
-		}
+		/*
+		AllocateArray zeroes the lists, which leaves them valid and empty.
+		Callbacks are Delegates, which are trivially copyable, so the lists
+		can be moved around by defragmentation like any other block.
+		*/
 
 		m_IsSetup = true;
 	}
@@ -36,63 +55,318 @@ namespace Soul
 	void EventBus::Shutdown()
 	{
 		Assert(m_IsSetup);
-		m_EventQueue.Deallocate();
+		if (m_WorkerPool)
+		{
+			DisableParallelDispatch();
+		}
+		m_EventStream.Deallocate();
+		for (UInt32 i = 0; i < MaxProducerThreads; ++i)
+		{
+			Assert(!m_ProducerClaims[i].load(std::memory_order_acquire));
+			delete m_StagingRings[i].exchange(nullptr, std::memory_order_acq_rel);
+		}
 		m_RegisteredCallbacks.Deallocate();
 		m_IsSetup = false;
 	}
 
+	void EventBus::RegisterProducerThread(UInt32 producerIndex)
+	{
+		Assert(producerIndex < MaxProducerThreads);
+
+		bool wasClaimed =
+			m_ProducerClaims[producerIndex].exchange(true, std::memory_order_acq_rel);
+		Assert(!wasClaimed);
+
+		/*
+		The MemoryManager isn't thread-safe, so rings come from the system
+		allocator instead; aligned new keeps their atomics on one cache line.
+		The ring outlives the thread so any events it left get dispatched,
+		and is reused by the next thread with this index.
+		*/
+		EventStagingRing* ring =
+			m_StagingRings[producerIndex].load(std::memory_order_acquire);
+		if (!ring)
+		{
+			ring = new EventStagingRing();
+			m_StagingRings[producerIndex].store(ring, std::memory_order_release);
+		}
+
+		m_ProducerRing = ring;
+		m_ProducerIndex = producerIndex;
+	}
+
+	void EventBus::UnregisterProducerThread()
+	{
+		Assert(m_ProducerRing);
+
+		m_ProducerRing = nullptr;
+		m_ProducerClaims[m_ProducerIndex].store(false, std::memory_order_release);
+	}
+
+	void EventBus::EnableParallelDispatch(UInt32 workerCount)
+	{
+		Assert(!m_WorkerPool);
+
+		m_WorkerPool = (WorkerPool*)AllocateAligned(m_WorkerPoolMemory, sizeof(WorkerPool));
+		new (m_WorkerPool) WorkerPool(workerCount);
+
+		m_BatchEvents = MemoryManager::Allocate<Vector<void*>>(64);
+		m_BatchOffsets =
+			MemoryManager::AllocateArray<ArraySize>((ArraySize)Events::EventTotal + 1);
+		m_ParallelJobs = MemoryManager::Allocate<Vector<ParallelJob>>(16);
+	}
+
+	void EventBus::DisableParallelDispatch()
+	{
+		Assert(m_WorkerPool);
+
+		m_WorkerPool->~WorkerPool();
+		m_WorkerPoolMemory.Deallocate();
+		m_WorkerPool = nullptr;
+
+		m_BatchEvents.Deallocate();
+		m_BatchOffsets.Deallocate();
+		m_ParallelJobs.Deallocate();
+	}
+
 	void EventBus::QueueEvent(Events eventType, void* data)
 	{
-		Event oEvent{ eventType, data };
-		m_EventQueue->Push(oEvent);
+		if (m_ProducerRing)
+		{
+			for (UInt32 attempt = 0; !m_ProducerRing->TryPushPointer(eventType, data); ++attempt)
+			{
+				WaitForDispatch(attempt);
+			}
+			return;
+		}
+
+		// Unregistered threads would race the dispatching thread on the stream.
+		Assert(std::this_thread::get_id() == m_DispatchThread);
+
+		m_EventStream->PushPointer(eventType, data);
+
+		if (m_EventStream->GetLength() > m_PeakEventCount)
+		{
+			m_PeakEventCount = m_EventStream->GetLength();
+		}
+	}
+
+	void EventBus::QueueEvent(Events eventType, const void* payload, UInt32 byteCount)
+	{
+		if (m_ProducerRing)
+		{
+			for (UInt32 attempt = 0; !m_ProducerRing->TryPush(eventType, payload, byteCount); ++attempt)
+			{
+				WaitForDispatch(attempt);
+			}
+			return;
+		}
+
+		// Unregistered threads would race the dispatching thread on the stream.
+		Assert(std::this_thread::get_id() == m_DispatchThread);
+
+		m_EventStream->Push(eventType, payload, byteCount);
+
+		if (m_EventStream->GetLength() > m_PeakEventCount)
+		{
+			m_PeakEventCount = m_EventStream->GetLength();
+		}
 	}
 
 	void EventBus::DispatchEvents()
 	{
+		Assert(std::this_thread::get_id() == m_DispatchThread);
+
 		/*
-		Dispatch up to the first "eventCount" events to all registered
-		callbacks for that event.
+		Move staged events over in producer order to keep dispatch
+		deterministic. They don't count towards the peak event count, which
+		sizes the stream for what the dispatching thread queues; staged
+		events are bounded by the rings instead.
 		*/
-		while (m_EventQueue->GetLength() > 0)
+		for (UInt32 i = 0; i < MaxProducerThreads; ++i)
 		{
-			Event currentEvent = m_EventQueue->Pop();
-			Vector<Callback>& eventCallbacks =
-				m_RegisteredCallbacks[(ArraySize)currentEvent.eventType];
-			for (ArraySize j = 0; j < eventCallbacks.Length(); ++j)
+			EventStagingRing* ring = m_StagingRings[i].load(std::memory_order_acquire);
+			if (ring)
 			{
-				eventCallbacks[j].callbackFunction(currentEvent.pointerToData);
+				ring->DrainInto(*m_EventStream);
 			}
 		}
+
+		/*
+		Dispatch every queued event, including ones queued by callbacks, to
+		all registered callbacks for that event. Events queued by callbacks
+		make up the next batch.
+		*/
+		while (m_EventStream->GetLength() > 0)
+		{
+			ArraySize batchLength = m_EventStream->GetLength();
+			if (m_WorkerPool)
+			{
+				DispatchThreadSafe(batchLength);
+			}
+			DispatchSerial(batchLength, m_WorkerPool != nullptr);
+		}
 	}
 
-	CallbackId EventBus::RegisterCallback(Events eventType, EventCallback callback)
+	ArraySize EventBus::GetPeakEventCount()
+	{
+		return m_PeakEventCount;
+	}
+
+	CallbackId EventBus::RegisterCallback(Events eventType, EventCallback callback,
+		bool isThreadSafe)
 	{
 		/*
 		Add new callback to registered callbacks vector and return the
 		CallbackId.
 		*/
-		Vector<Callback>& eventCallbacks =
+		CallbackList& eventCallbacks =
 			m_RegisteredCallbacks[(ArraySize)eventType];
 		CallbackId callbackId = m_CallbackCount++;
-		Callback tempCallback{ callback, callbackId };
-		eventCallbacks.Push(tempCallback);
+		eventCallbacks.Push(Callback{ std::move(callback), callbackId, isThreadSafe });
 		return callbackId;
 	}
 
 	void EventBus::UnregisterCallback(Events eventType, CallbackId Id)
 	{
 		/*
-		Find callback with given Id and remove from vector.
+		Find callback with given Id and remove from vector. Callback order
+		doesn't matter, so swap the last callback into its place.
 		*/
-		Vector<Callback>& eventCallbacks =
+		CallbackList& eventCallbacks =
 			m_RegisteredCallbacks[(ArraySize)eventType];
 		for (ArraySize i = 0; i < eventCallbacks.Length(); ++i)
 		{
 			if (eventCallbacks[i].callbackId == Id)
 			{
-				eventCallbacks.Remove(i);
+				eventCallbacks.SwapRemove(i);
 				break;
 			}
 		}
 	}
+
+	void EventBus::WaitForDispatch(UInt32 attempt)
+	{
+		/*
+		A full ring only empties when DispatchEvents() runs, usually once a
+		frame, so stop spinning soon and leave the core to the dispatching
+		thread.
+		*/
+		if (attempt < 16)
+		{
+			std::this_thread::yield();
+		}
+		else
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+	}
+
+	void EventBus::DispatchSerial(ArraySize eventCount, bool skipThreadSafe)
+	{
+		/*
+		Each event stays at the front of the stream until its callbacks are
+		done so its payload stays valid.
+		*/
+		Events eventType;
+		void* data;
+		for (ArraySize i = 0; i < eventCount; ++i)
+		{
+			m_EventStream->Peek(eventType, data);
+			CallbackList& eventCallbacks =
+				m_RegisteredCallbacks[(ArraySize)eventType];
+			for (ArraySize j = 0; j < eventCallbacks.Length(); ++j)
+			{
+				if (!skipThreadSafe || !eventCallbacks[j].isThreadSafe)
+				{
+					eventCallbacks[j].callbackFunction(data);
+				}
+			}
+			m_EventStream->Pop();
+		}
+	}
+
+	void EventBus::DispatchThreadSafe(ArraySize eventCount)
+	{
+		ArraySize typeCount = (ArraySize)Events::EventTotal;
+		ArraySize* offsets = m_BatchOffsets.GetMemory();
+		memset(offsets, 0, sizeof(ArraySize) * (typeCount + 1));
+
+		// Count the events of each type, then turn the counts into start offsets.
+		m_EventStream->ForEach(eventCount, [offsets](Events eventType, void* data) {
+			++offsets[(ArraySize)eventType + 1];
+		});
+
+		Vector<ParallelJob>& jobs = *m_ParallelJobs;
+		jobs.Clear();
+		for (ArraySize type = 0; type < typeCount; ++type)
+		{
+			ArraySize typeEventCount = offsets[type + 1];
+			offsets[type + 1] += offsets[type];
+			if (typeEventCount == 0)
+			{
+				continue;
+			}
+
+			CallbackList& eventCallbacks = m_RegisteredCallbacks[type];
+			for (ArraySize j = 0; j < eventCallbacks.Length(); ++j)
+			{
+				if (eventCallbacks[j].isThreadSafe)
+				{
+					jobs.Push(ParallelJob{ (UInt32)type, (UInt32)j });
+				}
+			}
+		}
+
+		if (jobs.Length() == 0)
+		{
+			return;
+		}
+
+		/*
+		Group the event data by type, keeping queue order within each type.
+		Afterwards offsets[type] holds where the next type starts, so a type's
+		events run from offsets[type - 1] to offsets[type].
+		*/
+		Vector<void*>& events = *m_BatchEvents;
+		events.Clear();
+		events.Reserve(eventCount);
+		for (ArraySize i = 0; i < eventCount; ++i)
+		{
+			events.Push(nullptr);
+		}
+		m_EventStream->ForEach(eventCount, [offsets, &events](Events eventType, void* data) {
+			events[offsets[(ArraySize)eventType]++] = data;
+		});
+
+		m_WorkerPool->Run(jobs.Length(), [](ArraySize jobIndex) {
+			RunParallelJob(jobIndex);
+		});
+	}
+
+	void EventBus::RunParallelJob(ArraySize jobIndex)
+	{
+		const ParallelJob& job = (*m_ParallelJobs)[jobIndex];
+		const EventCallback& callback =
+			m_RegisteredCallbacks[job.eventType][job.callbackIndex].callbackFunction;
+
+		const ArraySize* offsets = m_BatchOffsets.GetMemory();
+		ArraySize start = job.eventType == 0 ? 0 : offsets[job.eventType - 1];
+		ArraySize end = offsets[job.eventType];
+
+		const Vector<void*>& events = *m_BatchEvents;
+		for (ArraySize i = start; i < end; ++i)
+		{
+			callback(events[i]);
+		}
+	}
+
+	Byte* EventBus::AllocateAligned(UniqueHandle<Byte>& handle, ArraySize byteCount)
+	{
+		handle = MemoryManager::AllocateArray<Byte>(byteCount + CacheLineSize - 1);
+		handle.SetImmovable(true);
+
+		PtrSize start = (PtrSize)handle.GetMemory();
+		return (Byte*)((start + CacheLineSize - 1) & ~(CacheLineSize - 1));
+	}
 }
\ No newline at end of file
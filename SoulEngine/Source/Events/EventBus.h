@@ -2,36 +2,40 @@
 Transfers events to all registered event listeners in queue order.
 @file EventBus.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #pragma once
 
-#include <functional>
+#include <atomic>
+#include <thread>
+#include <type_traits>
 
+#include <Events/EventStagingRing.h>
+#include <Events/EventStream.h>
 #include <Events/EventTypes.h>
 #include <Memory/MemoryManager.h>
 #include <UtilsLib/CommonTypes.h>
-#include <UtilsLib/Containers/Queue.h>
+#include <UtilsLib/Containers/SmallVector.h>
 #include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Delegate.h>
+#include <UtilsLib/Threads/WorkerPool.h>
 
-typedef std::function<void(void*)> EventCallback;
+typedef Soul::Delegate<void(void*)> EventCallback;
 typedef UInt64 CallbackId;
 
 namespace Soul
 {
-	struct Event
-	{
-		Events eventType; // This Event's type
-		void* pointerToData; // The data associated with this event, if any.
-	};
-
 	struct Callback
 	{
 		EventCallback callbackFunction; // The actual callback.
 		CallbackId callbackId; // The id of this callback.
+		bool isThreadSafe; // Whether this callback may run on a worker thread.
 	};
 
+	// Most events only have a handful of callbacks, so keep those inline.
+	typedef SmallVector<Callback, 4> CallbackList;
+
 	/*
 	Singleton Event system which manages Events, registering callbacks for
 	events, and dispatching the events to call those callbacks. This system
@@ -39,15 +43,38 @@ namespace Soul
 
 	The functions for managing callbacks, such as RegisterCallback() and
 	UnregisterCallback() should only be used through the EventListener class.
+
+	Events may be queued from any thread. The thread that called StartUp()
+	queues straight into the event stream; every other thread must first
+	call RegisterProducerThread() and then queues into its own lock-free
+	staging ring. DispatchEvents() moves the staged events into the stream
+	before dispatching, so events are always dispatched in this order:
+	1. Events queued by the dispatching thread, in the order they were queued.
+	2. Events staged by producer 0, then producer 1, and so on, each in the
+	   order that producer queued them.
+	Events staged after DispatchEvents() starts wait for the next call.
+
+	Callbacks are called on the dispatching thread unless parallel dispatch
+	has been enabled with EnableParallelDispatch(). Then each batch of events
+	is dispatched in two steps: first every callback registered as
+	thread-safe runs on the worker pool, each one receiving its events in
+	order on a single thread, and then the other callbacks run on the
+	dispatching thread as usual. DispatchEvents() doesn't return until both
+	steps are done.
 	*/
 	class EventBus
 	{
 	public:
+		/*
+		Maximum number of worker threads that can queue events at once.
+		*/
+		static constexpr UInt32 MaxProducerThreads = 8;
 
 		/*
 		Initializes this EventBus with the desired number of potential events.
 		
-		@param eventCount - How many events can be stored in this bus.
+		@param eventCount - Roughly how many events the bus has room for before
+		                    its queue needs to grow.
 		*/
 		static void StartUp(ArraySize eventCount);
 
@@ -57,12 +84,82 @@ namespace Soul
 		static void Shutdown();
 
 		/*
-		Adds a new event to the end of event queue to be dispatched.
+		Lets the calling worker thread queue events. Events it queues are
+		dispatched after those of lower producer indices. At most one thread
+		may use each index at a time.
+
+		The first thread to use an index creates its staging ring, which
+		holds EventStagingRing::Capacity bytes of events. If the ring fills
+		up, QueueEvent() waits until the next DispatchEvents() makes room.
+
+		@param producerIndex - The thread's producer index, less than
+		                       MaxProducerThreads.
+		*/
+		static void RegisterProducerThread(UInt32 producerIndex);
+
+		/*
+		Stops the calling worker thread from queueing events, freeing its
+		producer index for another thread.
+		*/
+		static void UnregisterProducerThread();
+
+		/*
+		Starts dispatching callbacks registered as thread-safe on a pool of
+		worker threads. Must be called from the dispatching thread.
+
+		@param workerCount - Number of worker threads to start, not counting
+		                     the dispatching thread, which also helps. At
+		                     most WorkerPool::MaxThreads.
+		*/
+		static void EnableParallelDispatch(UInt32 workerCount);
+
+		/*
+		Stops the worker threads started by EnableParallelDispatch(), going
+		back to calling every callback on the dispatching thread.
+		*/
+		static void DisableParallelDispatch();
+
+		/*
+		Adds a new event to the end of event queue to be dispatched. The data
+		is passed to the callbacks as is, so it must stay alive until the event
+		has been dispatched.
+
+		@param eventType - The type of the event.
+
+		@param data - Pointer handed to the event's callbacks.
 		*/
 		static void QueueEvent(Events eventType, void* data);
 
 		/*
-		Dispatches all events to attached event listeners.
+		Adds a new event to the end of the event queue, copying its payload
+		into the queue. Callbacks receive a pointer to the copy, which is only
+		valid for the duration of the callback.
+
+		@param eventType - The type of the event.
+
+		@param payload - The bytes to copy.
+
+		@param byteCount - Number of bytes to copy, at most
+		                   EventStream::MaxPayloadSize.
+		*/
+		static void QueueEvent(Events eventType, const void* payload, UInt32 byteCount);
+
+		/*
+		Adds a new event to the end of the event queue, copying the payload
+		into the queue so it doesn't need to outlive this call.
+
+		@param eventType - The type of the event.
+
+		@param payload - A small, trivially copyable value. Callbacks receive
+		                 a pointer to a copy of it.
+		*/
+		template <class T, class = typename std::enable_if<
+			!std::is_pointer<T>::value && !std::is_null_pointer<T>::value>::type>
+		static void QueueEvent(Events eventType, const T& payload);
+
+		/*
+		Dispatches all events to attached event listeners. Must be called
+		from the thread that called StartUp().
 		*/
 		static void DispatchEvents();
 
@@ -73,9 +170,15 @@ namespace Soul
 
 		@param callback - The callback function to be registered.
 
+		@param isThreadSafe - Whether the callback may run on a worker thread
+		                      at the same time as other callbacks. It must not
+		                      queue events, register or unregister callbacks,
+		                      or use the MemoryManager.
+
 		@return callbackId containing the unique callback id.
 		*/
-		static CallbackId RegisterCallback(Events eventType, EventCallback callback);
+		static CallbackId RegisterCallback(Events eventType, EventCallback callback,
+			bool isThreadSafe = false);
 
 		/*
 		Unregisters the callback with the given id from the given event.
@@ -86,12 +189,98 @@ namespace Soul
 		*/
 		static void UnregisterCallback(Events eventType, CallbackId callbackId);
 
+		/*
+		Returns the highest number of events that have been queued at once
+		since StartUp().
+
+		@return ArraySize containing the peak number of queued events.
+		*/
+		static ArraySize GetPeakEventCount();
+
 		EventBus() = delete;
 
 	private:
-		static UniqueHandle<Queue<Event>> m_EventQueue; // Queue of events to be dispatched.
-		static UniqueHandle<Vector<Callback>> m_RegisteredCallbacks; // All registered callbacks
+		/*
+		Backs off while a producer thread's staging ring is full.
+
+		@param attempt - How many times the caller has already waited.
+		*/
+		static void WaitForDispatch(UInt32 attempt);
+
+		/*
+		Calls every callback on the dispatching thread for the given number
+		of events at the front of the stream, then removes them.
+
+		@param eventCount - Number of events to dispatch.
+
+		@param skipThreadSafe - Whether to leave out thread-safe callbacks,
+		                        because they already ran on the workers.
+		*/
+		static void DispatchSerial(ArraySize eventCount, bool skipThreadSafe);
+
+		/*
+		Runs every thread-safe callback on the worker pool for the given
+		number of events at the front of the stream.
+
+		@param eventCount - Number of events to dispatch.
+		*/
+		static void DispatchThreadSafe(ArraySize eventCount);
+
+		/*
+		Calls one thread-safe callback for each of its events in the current
+		batch. Runs on the worker pool.
+
+		@param jobIndex - Index into m_ParallelJobs.
+		*/
+		static void RunParallelJob(ArraySize jobIndex);
+
+		/*
+		Allocates a pinned block aligned to CacheLineSize, for objects that
+		other threads use without the MemoryManager knowing.
+
+		@param handle - Receives the block.
+
+		@param byteCount - Number of usable bytes.
+
+		@return Pointer to the first aligned byte.
+		*/
+		static Byte* AllocateAligned(UniqueHandle<Byte>& handle, ArraySize byteCount);
+
+	private:
+		struct ParallelJob
+		{
+			UInt32 eventType; // The event type the callback is registered for.
+			UInt32 callbackIndex; // The callback's index in its CallbackList.
+		};
+
+	private:
+		static UniqueHandle<EventStream> m_EventStream; // Queue of events to be dispatched.
+		static std::atomic<EventStagingRing*> m_StagingRings[MaxProducerThreads]; // Events queued by each producer, created on first use.
+		static std::atomic<bool> m_ProducerClaims[MaxProducerThreads]; // Whether a thread is using each producer index.
+		static thread_local EventStagingRing* m_ProducerRing; // The calling thread's staging ring, if it is a producer.
+		static thread_local UInt32 m_ProducerIndex; // The calling thread's producer index, if it is a producer.
+		static std::thread::id m_DispatchThread; // The thread that called StartUp(), the only one that may skip registering.
+		static UniqueHandle<CallbackList> m_RegisteredCallbacks; // All registered callbacks
+		static UniqueHandle<Byte> m_WorkerPoolMemory; // Pinned block holding m_WorkerPool.
+		static WorkerPool* m_WorkerPool; // Runs thread-safe callbacks, or nullptr if disabled.
+		static UniqueHandle<Vector<void*>> m_BatchEvents; // The batch's event data, grouped by event type.
+		static UniqueHandle<ArraySize> m_BatchOffsets; // Where each event type starts in m_BatchEvents.
+		static UniqueHandle<Vector<ParallelJob>> m_ParallelJobs; // The batch's thread-safe callbacks.
 		static CallbackId m_CallbackCount; // Used for identifying unique callbacks.
+		static ArraySize m_PeakEventCount; // Highest number of events queued at once.
 		static bool m_IsSetup; // Whether this EventBus has been initialized.
 	};
+
+	template <class T, class>
+	void EventBus::QueueEvent(Events eventType, const T& payload)
+	{
+		static_assert(std::is_trivially_copyable<T>::value,
+			"Event payloads must be trivially copyable.");
+		static_assert(sizeof(T) <= EventStream::MaxPayloadSize,
+			"Event payload is too large to copy into the queue.");
+		static_assert(alignof(T) <= 8,
+			"Event payloads are only aligned to 8 bytes.");
+
+		QueueEvent(eventType, &payload, (UInt32)sizeof(T));
+	}
 }
\ No newline at end of file
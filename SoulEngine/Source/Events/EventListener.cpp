@@ -3,7 +3,7 @@ Manages adding and removing callbacks with the EventBus to provide a thin
 layer of abstraction and automation.
 @file EventListener.h
 @author Jacob Peterson
-@edited 4/14/21
+@edited 10/19/26
 */
 
 #include "EventListener.h"
@@ -11,7 +11,7 @@ layer of abstraction and automation.
 namespace Soul
 {
 	EventListener::EventListener() :
-		m_RegisteredCallbacks(4)
+		m_RegisteredCallbacks()
 	{
 	
 	}
@@ -42,10 +42,11 @@ namespace Soul
 		EventBus::QueueEvent(eventType, data);
 	}
 
-	CallbackId EventListener::RegisterCallback(Events eventType, EventCallback callbackFunction)
+	CallbackId EventListener::RegisterCallback(Events eventType, EventCallback callbackFunction,
+		bool isThreadSafe)
 	{
 		RegisteredCallback callback =
-		{ eventType, EventBus::RegisterCallback(eventType, callbackFunction) };
+		{ eventType, EventBus::RegisterCallback(eventType, callbackFunction, isThreadSafe) };
 		m_RegisteredCallbacks.Push(callback);
 		return callback.callbackId;
 	}
@@ -58,6 +59,7 @@ namespace Soul
 			if (callback.eventType == eventType)
 			{
 				EventBus::UnregisterCallback(eventType, callback.callbackId);
+				m_RegisteredCallbacks.SwapRemove(i);
 				break;
 			}
 		}
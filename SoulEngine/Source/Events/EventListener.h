@@ -3,12 +3,13 @@ Manages adding and removing callbacks with the EventBus to provide a thin
 layer of abstraction and automation.
 @file EventListener.h
 @author Jacob Peterson
-@edited 4/14/21
+@edited 10/19/26
 */
 
 #pragma once
 
 #include <Events/EventBus.h>
+#include <UtilsLib/Containers/SmallVector.h>
 
 namespace Soul
 {
@@ -36,10 +37,24 @@ namespace Soul
 		EventListener& operator=(EventListener&& otherListener);
 
 		/*
-		Adds a new event to the end of event queue to be dispatched.
+		Adds a new event to the end of event queue to be dispatched. The data
+		must stay alive until the event has been dispatched.
 		*/
 		void QueueEvent(Events eventType, void* data);
 
+		/*
+		Adds a new event to the end of event queue to be dispatched, copying
+		the payload into the queue.
+
+		@param eventType - The type of the event.
+
+		@param payload - A small, trivially copyable value. Callbacks receive
+		                 a pointer to a copy of it.
+		*/
+		template <class T, class = typename std::enable_if<
+			!std::is_pointer<T>::value && !std::is_null_pointer<T>::value>::type>
+		void QueueEvent(Events eventType, const T& payload);
+
 		/*
 		Adds a new callback to be called when the given event is triggered.
 
@@ -47,9 +62,14 @@ namespace Soul
 
 		@param callback - The callback function to be registered.
 
+		@param isThreadSafe - Whether the callback may run on a worker thread
+		                      when parallel dispatch is enabled. See
+		                      EventBus::RegisterCallback().
+
 		@return CallbackId containing the unique callback id.
 		*/
-		CallbackId RegisterCallback(Events eventType, EventCallback callback);
+		CallbackId RegisterCallback(Events eventType, EventCallback callback,
+			bool isThreadSafe = false);
 
 		/*
 		Unregisters the callback with the given id from the given event.
@@ -62,6 +82,12 @@ namespace Soul
 		EventListener& operator=(const EventListener&) = delete;
 
 	private:
-		Vector<RegisteredCallback> m_RegisteredCallbacks; // The callback Id for each registeredevent.
+		SmallVector<RegisteredCallback, 4> m_RegisteredCallbacks; // The callback Id for each registeredevent.
 	};
+
+	template <class T, class>
+	void EventListener::QueueEvent(Events eventType, const T& payload)
+	{
+		EventBus::QueueEvent(eventType, payload);
+	}
 }
\ No newline at end of file
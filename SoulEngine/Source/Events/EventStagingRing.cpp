@@ -0,0 +1,150 @@
+/*
+A lock-free ring of event records for handing events from one worker thread
+to the thread that dispatches them.
+@file EventStagingRing.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "EventStagingRing.h"
+
+#include <cstring>
+
+#include <UtilsLib/Macros.h>
+
+namespace Soul
+{
+	EventStagingRing::EventStagingRing() :
+		m_Tail(0),
+		m_PendingTail(0),
+		m_CachedHead(0),
+		m_Head(0)
+	{
+		static_assert((Capacity & Mask) == 0, "Capacity must be a power of two.");
+	}
+
+	bool EventStagingRing::TryPush(Events eventType, const void* payload, UInt32 byteCount)
+	{
+		Assert(byteCount <= EventStream::MaxPayloadSize);
+
+		RecordHeader* header = BeginPush(byteCount);
+		if (!header)
+		{
+			return false;
+		}
+
+		header->eventType = (UInt32)eventType;
+		header->payloadSize = byteCount;
+		if (byteCount > 0)
+		{
+			memcpy(header + 1, payload, byteCount);
+		}
+		EndPush();
+
+		return true;
+	}
+
+	bool EventStagingRing::TryPushPointer(Events eventType, void* data)
+	{
+		RecordHeader* header = BeginPush(PointerPayload);
+		if (!header)
+		{
+			return false;
+		}
+
+		header->eventType = (UInt32)eventType;
+		header->payloadSize = PointerPayload;
+		memcpy(header + 1, &data, sizeof(void*));
+		EndPush();
+
+		return true;
+	}
+
+	ArraySize EventStagingRing::DrainInto(EventStream& stream)
+	{
+		ArraySize head = m_Head.load(std::memory_order_relaxed);
+		ArraySize tail = m_Tail.load(std::memory_order_acquire);
+		ArraySize eventCount = 0;
+
+		while (head != tail)
+		{
+			ArraySize offset = head & Mask;
+			RecordHeader* header = (RecordHeader*)(m_Records + offset);
+			if (header->eventType == SkipRecord)
+			{
+				head += Capacity - offset;
+				continue;
+			}
+
+			if (header->payloadSize == PointerPayload)
+			{
+				void* data;
+				memcpy(&data, header + 1, sizeof(void*));
+				stream.PushPointer((Events)header->eventType, data);
+			}
+			else
+			{
+				stream.Push((Events)header->eventType, header + 1, header->payloadSize);
+			}
+
+			head += GetRecordSize(header->payloadSize);
+			++eventCount;
+		}
+
+		m_Head.store(head, std::memory_order_release);
+
+		return eventCount;
+	}
+
+	ArraySize EventStagingRing::GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	EventStagingRing::RecordHeader* EventStagingRing::BeginPush(UInt32 payloadSize)
+	{
+		ArraySize tail = m_Tail.load(std::memory_order_relaxed);
+		ArraySize recordSize = GetRecordSize(payloadSize);
+		ArraySize offset = tail & Mask;
+
+		// A record that doesn't fit before the end also uses up those bytes.
+		ArraySize bytesLeft = Capacity - offset;
+		ArraySize neededSize = bytesLeft < recordSize ? bytesLeft + recordSize : recordSize;
+
+		/*
+		Only touch the consumer's cache line when our cached view says the
+		ring is full.
+		*/
+		if (tail + neededSize - m_CachedHead > Capacity)
+		{
+			m_CachedHead = m_Head.load(std::memory_order_acquire);
+			if (tail + neededSize - m_CachedHead > Capacity)
+			{
+				return nullptr;
+			}
+		}
+
+		if (neededSize != recordSize)
+		{
+			((RecordHeader*)(m_Records + offset))->eventType = SkipRecord;
+			tail += bytesLeft;
+			offset = 0;
+		}
+
+		m_PendingTail = tail + recordSize;
+
+		return (RecordHeader*)(m_Records + offset);
+	}
+
+	void EventStagingRing::EndPush()
+	{
+		m_Tail.store(m_PendingTail, std::memory_order_release);
+	}
+
+	ArraySize EventStagingRing::GetRecordSize(UInt32 payloadSize)
+	{
+		ArraySize byteCount = sizeof(RecordHeader) +
+			(payloadSize == PointerPayload ? sizeof(void*) : payloadSize);
+		return (byteCount + RecordAlignment - 1) & ~(RecordAlignment - 1);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+A lock-free ring of event records for handing events from one worker thread
+to the thread that dispatches them.
+@file EventStagingRing.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <atomic>
+
+#include <Events/EventStream.h>
+#include <Events/EventTypes.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Threads/ThreadSafeQueue.h>
+
+namespace Soul
+{
+	/*
+	A bounded, single-producer single-consumer byte ring holding the same
+	kind of variable-sized event records as an EventStream. One producer
+	thread pushes events into it without locks, and the dispatching thread
+	moves them into the EventStream in the order they were pushed.
+
+	Like the SPSCQueue, the positions written by each side live on their own
+	cache line and each side caches its last view of the other's position.
+	Positions only ever increase; the buffer offset is the position masked by
+	the capacity.
+
+	The records are stored inline, so the ring never touches the
+	MemoryManager and can be created from any thread. It must not move while
+	other threads are using it, and must be placed in memory aligned to
+	CacheLineSize; an atomic split across two cache lines is extremely slow.
+	*/
+	class alignas(CacheLineSize) EventStagingRing
+	{
+	public:
+		/*
+		Number of bytes for records. A producer that fills its ring waits
+		for the next dispatch, so this bounds how far one can run ahead.
+		*/
+		static constexpr ArraySize Capacity = 32 * 1024;
+
+		EventStagingRing();
+
+		/*
+		Copies an event and its payload into the ring. Must only be called
+		from the producer thread.
+
+		@param eventType - The type of the event.
+
+		@param payload - The bytes to copy, or nullptr if byteCount is 0.
+
+		@param byteCount - The number of payload bytes, at most
+		                   EventStream::MaxPayloadSize.
+
+		@return Whether there was room for the event.
+		*/
+		bool TryPush(Events eventType, const void* payload, UInt32 byteCount);
+
+		/*
+		Adds an event whose payload is owned elsewhere to the ring. Must only
+		be called from the producer thread.
+
+		@param eventType - The type of the event.
+
+		@param data - The pointer to hand to the event's callbacks.
+
+		@return Whether there was room for the event.
+		*/
+		bool TryPushPointer(Events eventType, void* data);
+
+		/*
+		Moves every event pushed so far onto the back of the given stream, in
+		order. Events pushed while this runs are left for the next call. Must
+		only be called from the consumer thread.
+
+		@param stream - The stream to append the events to.
+
+		@return ArraySize containing the number of events moved.
+		*/
+		ArraySize DrainInto(EventStream& stream);
+
+		/*
+		Gets the number of bytes the ring can hold.
+
+		@return ArraySize containing the capacity in bytes.
+		*/
+		ArraySize GetCapacity() const;
+
+		EventStagingRing(const EventStagingRing&) = delete;
+		EventStagingRing& operator=(const EventStagingRing&) = delete;
+
+	private:
+		struct RecordHeader
+		{
+			UInt32 eventType; // The event's type, or SkipRecord for unused bytes.
+			UInt32 payloadSize; // Payload bytes, or PointerPayload.
+		};
+
+		/*
+		Reserves room for a record, skipping to the front of the buffer if it
+		doesn't fit before the end.
+
+		@param payloadSize - The record's payload size field.
+
+		@return Pointer to the record's header, or nullptr if the ring is full.
+		*/
+		RecordHeader* BeginPush(UInt32 payloadSize);
+
+		/*
+		Publishes the record reserved by the last BeginPush().
+		*/
+		void EndPush();
+
+		/*
+		Gets the number of bytes a record takes up in the buffer.
+
+		@param payloadSize - The record's payload size field.
+
+		@return ArraySize containing the record's size in bytes.
+		*/
+		static ArraySize GetRecordSize(UInt32 payloadSize);
+
+	private:
+		static constexpr UInt32 SkipRecord = (UInt32)-1;
+		static constexpr UInt32 PointerPayload = (UInt32)-1;
+		static constexpr ArraySize RecordAlignment = sizeof(RecordHeader);
+
+		static constexpr ArraySize Mask = Capacity - 1;
+
+		Byte m_ProducerPadding[CacheLineSize];
+
+		std::atomic<ArraySize> m_Tail; // Position after the last record. Written by producer.
+		ArraySize m_PendingTail; // Tail once the reserved record is published.
+		ArraySize m_CachedHead; // Producer's last view of m_Head.
+		Byte m_ConsumerPadding[CacheLineSize];
+
+		std::atomic<ArraySize> m_Head; // Position of the first record. Written by consumer.
+		Byte m_EndPadding[CacheLineSize];
+
+		alignas(RecordAlignment) Byte m_Records[Capacity]; // The records.
+	};
+}
\ No newline at end of file
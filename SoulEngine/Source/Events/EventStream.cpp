@@ -0,0 +1,214 @@
+/*
+A FIFO stream of variable-sized event records with their payloads inline.
+@file EventStream.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "EventStream.h"
+
+#include <cstring>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Maths/Functions.h>
+
+namespace Soul
+{
+	EventStream::EventStream(ArraySize byteCapacity) :
+		m_Records(nullptr),
+		m_Capacity(0),
+		m_Head(0),
+		m_Tail(0),
+		m_Length(0)
+	{
+		ArraySize capacity = NextPowerOfTwo(byteCapacity < 64 ? 64 : byteCapacity);
+		m_Records = AllocateBuffer(m_Buffer, capacity);
+		m_Capacity = capacity;
+	}
+
+	void EventStream::Push(Events eventType, const void* payload, UInt32 byteCount)
+	{
+		Assert(byteCount <= MaxPayloadSize);
+
+		RecordHeader* header = Allocate(byteCount);
+		header->eventType = (UInt32)eventType;
+		header->payloadSize = byteCount;
+		if (byteCount > 0)
+		{
+			memcpy(header + 1, payload, byteCount);
+		}
+	}
+
+	void EventStream::PushPointer(Events eventType, void* data)
+	{
+		RecordHeader* header = Allocate(PointerPayload);
+		header->eventType = (UInt32)eventType;
+		header->payloadSize = PointerPayload;
+		memcpy(header + 1, &data, sizeof(void*));
+	}
+
+	bool EventStream::Peek(Events& eventType, void*& data)
+	{
+		if (m_Length == 0)
+		{
+			return false;
+		}
+
+		RecordHeader* header = GetHeadRecord();
+		eventType = (Events)header->eventType;
+		if (header->payloadSize == PointerPayload)
+		{
+			memcpy(&data, header + 1, sizeof(void*));
+		}
+		else
+		{
+			data = header + 1;
+		}
+
+		return true;
+	}
+
+	void EventStream::Pop()
+	{
+		Assert(m_Length > 0);
+
+		m_Head += GetRecordSize(GetHeadRecord()->payloadSize);
+		if (--m_Length == 0)
+		{
+			m_Head = 0;
+			m_Tail = 0;
+		}
+
+		// Nothing can point into the old buffer once its head record is gone.
+		if (m_RetiredBuffer.IsValid())
+		{
+			m_RetiredBuffer.Deallocate();
+		}
+	}
+
+	ArraySize EventStream::GetLength() const
+	{
+		return m_Length;
+	}
+
+	ArraySize EventStream::GetCapacity() const
+	{
+		return m_Capacity;
+	}
+
+	EventStream::RecordHeader* EventStream::Allocate(UInt32 payloadSize)
+	{
+		ArraySize recordSize = GetRecordSize(payloadSize);
+
+		bool fits;
+		if (m_Length == 0 || m_Tail > m_Head)
+		{
+			if (m_Capacity - m_Tail >= recordSize)
+			{
+				fits = true;
+			}
+			else if (m_Head >= recordSize)
+			{
+				// Skip the bytes left at the end and start over at the front.
+				if (m_Tail < m_Capacity)
+				{
+					((RecordHeader*)(m_Records + m_Tail))->eventType = SkipRecord;
+				}
+				m_Tail = 0;
+				fits = true;
+			}
+			else
+			{
+				fits = false;
+			}
+		}
+		else
+		{
+			fits = m_Head - m_Tail >= recordSize;
+		}
+
+		if (!fits)
+		{
+			Grow(m_Capacity + recordSize);
+		}
+
+		RecordHeader* header = (RecordHeader*)(m_Records + m_Tail);
+		m_Tail += recordSize;
+		++m_Length;
+
+		return header;
+	}
+
+	void EventStream::Grow(ArraySize minimumCapacity)
+	{
+		ArraySize capacity = NextPowerOfTwo(minimumCapacity);
+		UniqueHandle<Byte> newBuffer;
+		Byte* newRecords = AllocateBuffer(newBuffer, capacity);
+
+		// Copy the records over in order, dropping any skipped bytes.
+		ArraySize offset = m_Head;
+		ArraySize byteCount = 0;
+		for (ArraySize i = 0; i < m_Length; ++i)
+		{
+			if (offset == m_Capacity ||
+				((RecordHeader*)(m_Records + offset))->eventType == SkipRecord)
+			{
+				offset = 0;
+			}
+
+			ArraySize recordSize =
+				GetRecordSize(((RecordHeader*)(m_Records + offset))->payloadSize);
+			memcpy(newRecords + byteCount, m_Records + offset, recordSize);
+			offset += recordSize;
+			byteCount += recordSize;
+		}
+
+		/*
+		The head record may be in the middle of being dispatched, so keep the
+		buffer it lives in around until it is popped. If a buffer is already
+		retired, that one holds the head record and this one can go.
+		*/
+		if (!m_RetiredBuffer.IsValid())
+		{
+			m_RetiredBuffer = std::move(m_Buffer);
+		}
+		m_Buffer = std::move(newBuffer);
+		m_Records = newRecords;
+		m_Capacity = capacity;
+		m_Head = 0;
+		m_Tail = byteCount;
+	}
+
+	EventStream::RecordHeader* EventStream::GetHeadRecord()
+	{
+		if (m_Head == m_Capacity ||
+			((RecordHeader*)(m_Records + m_Head))->eventType == SkipRecord)
+		{
+			m_Head = 0;
+		}
+
+		return (RecordHeader*)(m_Records + m_Head);
+	}
+
+	ArraySize EventStream::GetRecordSize(UInt32 payloadSize)
+	{
+		ArraySize byteCount = sizeof(RecordHeader) +
+			(payloadSize == PointerPayload ? sizeof(void*) : payloadSize);
+		return (byteCount + RecordAlignment - 1) & ~(RecordAlignment - 1);
+	}
+
+	Byte* EventStream::AllocateBuffer(UniqueHandle<Byte>& handle, ArraySize capacity)
+	{
+		/*
+		MemoryManager blocks aren't aligned, so over-allocate, pin the block
+		and align the records within it.
+		*/
+		handle = MemoryManager::AllocateArray<Byte>(capacity + RecordAlignment - 1);
+		handle.SetImmovable(true);
+
+		PtrSize start = (PtrSize)handle.GetMemory();
+		return (Byte*)((start + RecordAlignment - 1) & ~(RecordAlignment - 1));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,211 @@
+/*
+A FIFO stream of variable-sized event records with their payloads inline.
+@file EventStream.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <cstring>
+
+#include <Events/EventTypes.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	Stores queued events back to back in a single byte ring buffer. Each
+	record is a small header followed by the event's payload, copied in at
+	Push() time, so producers don't have to keep payloads alive until the
+	events are dispatched and dispatching reads memory in order.
+
+	A record never wraps around the end of the buffer; if it doesn't fit in
+	the bytes left before the end, those bytes are skipped and the record
+	starts at the front. The buffer's capacity is a power of two and doubles
+	when a record doesn't fit anywhere.
+
+	Payloads stay valid from Peek() until the matching Pop(), even if records
+	pushed in the meantime make the buffer grow.
+	*/
+	class EventStream
+	{
+	public:
+		/*
+		Largest payload, in bytes, that can be copied into the stream.
+		*/
+		static constexpr UInt32 MaxPayloadSize = 256;
+
+		/*
+		@param byteCapacity - Number of preallocated bytes. Rounded up to the
+		                      next power of two.
+		*/
+		EventStream(ArraySize byteCapacity);
+
+		/*
+		Copies an event and its payload onto the back of the stream.
+
+		@param eventType - The type of the event.
+
+		@param payload - The bytes to copy, or nullptr if byteCount is 0.
+
+		@param byteCount - The number of payload bytes, at most
+		                   MaxPayloadSize.
+		*/
+		void Push(Events eventType, const void* payload, UInt32 byteCount);
+
+		/*
+		Adds an event whose payload is owned elsewhere to the back of the
+		stream. Only the pointer itself is stored.
+
+		@param eventType - The type of the event.
+
+		@param data - The pointer to hand to the event's callbacks.
+		*/
+		void PushPointer(Events eventType, void* data);
+
+		/*
+		Looks at the event at the front of the stream.
+
+		@param eventType - Receives the type of the event.
+
+		@param data - Receives the pointer to hand to the event's callbacks:
+		              either the inline payload or the pushed pointer.
+
+		@return Whether there was an event to look at.
+		*/
+		bool Peek(Events& eventType, void*& data);
+
+		/*
+		Removes the event at the front of the stream.
+		*/
+		void Pop();
+
+		/*
+		Calls the given function for the events at the front of the stream,
+		front to back, without removing them. Nothing may be pushed while this
+		runs.
+
+		@param count - Number of events to visit, at most GetLength().
+
+		@param function - Callable taking (Events eventType, void* data).
+		*/
+		template <class Function>
+		void ForEach(ArraySize count, Function function) const;
+
+		/*
+		Gets the number of events in the stream.
+
+		@return ArraySize containing the number of events.
+		*/
+		ArraySize GetLength() const;
+
+		/*
+		Gets the number of bytes the stream can hold before it grows.
+
+		@return ArraySize containing the capacity in bytes.
+		*/
+		ArraySize GetCapacity() const;
+
+		EventStream(const EventStream&) = delete;
+		EventStream& operator=(const EventStream&) = delete;
+
+	private:
+		struct RecordHeader
+		{
+			UInt32 eventType; // The event's type, or SkipRecord for unused bytes.
+			UInt32 payloadSize; // Payload bytes, or PointerPayload.
+		};
+
+		/*
+		Reserves room for a record at the back of the stream, growing the
+		buffer if needed.
+
+		@param payloadSize - Number of payload bytes the record needs.
+
+		@return Pointer to the record's header.
+		*/
+		RecordHeader* Allocate(UInt32 payloadSize);
+
+		/*
+		Moves every record to the front of a buffer at least twice as large,
+		keeping the old buffer alive until the next Pop().
+
+		@param minimumCapacity - The smallest acceptable new capacity.
+		*/
+		void Grow(ArraySize minimumCapacity);
+
+		/*
+		Gets the number of bytes a record takes up in the buffer.
+
+		@param payloadSize - The record's payload size field.
+
+		@return ArraySize containing the record's size in bytes.
+		*/
+		static ArraySize GetRecordSize(UInt32 payloadSize);
+
+		/*
+		Gets the record at the front of the stream, moving m_Head past any
+		skipped bytes at the end of the buffer first.
+
+		@return Pointer to the front record's header.
+		*/
+		RecordHeader* GetHeadRecord();
+
+		/*
+		Allocates a pinned buffer and aligns it for record headers.
+
+		@param handle - Receives the buffer.
+
+		@param capacity - Number of usable bytes.
+
+		@return Pointer to the first aligned byte.
+		*/
+		static Byte* AllocateBuffer(UniqueHandle<Byte>& handle, ArraySize capacity);
+
+	private:
+		static constexpr UInt32 SkipRecord = (UInt32)-1;
+		static constexpr UInt32 PointerPayload = (UInt32)-1;
+		static constexpr ArraySize RecordAlignment = sizeof(RecordHeader);
+
+		UniqueHandle<Byte> m_Buffer; // The records.
+		UniqueHandle<Byte> m_RetiredBuffer; // Previous buffer, alive until the next Pop().
+		Byte* m_Records; // Aligned start of m_Buffer, which is pinned.
+		ArraySize m_Capacity; // Usable bytes in m_Buffer, always a power of two.
+		ArraySize m_Head; // Offset of the first record.
+		ArraySize m_Tail; // Offset just past the last record.
+		ArraySize m_Length; // Number of records.
+	};
+
+	template <class Function>
+	void EventStream::ForEach(ArraySize count, Function function) const
+	{
+		Assert(count <= m_Length);
+
+		ArraySize offset = m_Head;
+		for (ArraySize i = 0; i < count; ++i)
+		{
+			if (offset == m_Capacity ||
+				((const RecordHeader*)(m_Records + offset))->eventType == SkipRecord)
+			{
+				offset = 0;
+			}
+
+			const RecordHeader* header = (const RecordHeader*)(m_Records + offset);
+			void* data = (void*)(header + 1);
+			if (header->payloadSize == PointerPayload)
+			{
+				memcpy(&data, header + 1, sizeof(void*));
+			}
+
+			function((Events)header->eventType, data);
+			offset += GetRecordSize(header->payloadSize);
+		}
+	}
+
+	template <>
+	struct IsTriviallyRelocatable<EventStream> : std::true_type {};
+}
\ No newline at end of file
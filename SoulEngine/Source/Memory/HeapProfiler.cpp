@@ -0,0 +1,246 @@
+/*
+Samples MemoryManager allocations and aggregates them by call site.
+@file HeapProfiler.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "HeapProfiler.h"
+
+#include <cstdio>
+
+#include <Memory/MemoryManager.h>
+#include <UtilsLib/Logger.h>
+
+#include <Windows.h>
+#include <Psapi.h>
+
+namespace Soul
+{
+	PtrSize HeapProfiler::m_SampleRate = 0;
+	PtrSize HeapProfiler::m_WeightRate = 0;
+	Int64 HeapProfiler::m_BytesUntilSample = 0;
+	AllocationSite* HeapProfiler::m_Sites = nullptr;
+	UInt32 HeapProfiler::m_SiteTableLength = 1024;
+
+	void HeapProfiler::SetSampleRate(PtrSize sampleRate)
+	{
+		if (sampleRate && !m_Sites)
+		{
+			/*
+			The site table lives outside the arena so profiling doesn't change
+			the layout of what it is measuring.
+			*/
+			m_Sites = (AllocationSite*)malloc(sizeof(AllocationSite) * m_SiteTableLength);
+			memset(m_Sites, 0, sizeof(AllocationSite) * m_SiteTableLength);
+		}
+
+		m_SampleRate = sampleRate;
+		m_BytesUntilSample = (Int64)sampleRate;
+		if (sampleRate)
+		{
+			m_WeightRate = sampleRate;
+		}
+	}
+
+	void HeapProfiler::RecordAllocation(Handle* handle)
+	{
+		m_BytesUntilSample -= (Int64)handle->byteSize;
+		if (m_BytesUntilSample > 0)
+		{
+			return;
+		}
+
+		while (m_BytesUntilSample <= 0)
+		{
+			m_BytesUntilSample += (Int64)m_SampleRate;
+		}
+
+		/*
+		Capture the call stack, skipping this function.
+		*/
+		void* frames[16];
+		DWORD hash;
+		UInt32 frameCount = CaptureStackBackTrace(1, 16, frames, &hash);
+		Int32 siteIndex = frameCount ? FindSite(frames, frameCount, hash) : -1;
+		if (siteIndex < 0)
+		{
+			return;
+		}
+
+		AllocationSite& site = m_Sites[siteIndex];
+		UInt64 sampledBytes = GetSampledBytes(handle);
+		UInt64 sampledObjects =
+			handle->byteSize ? sampledBytes / handle->byteSize : 1;
+		site.liveObjects += sampledObjects;
+		site.liveBytes += sampledBytes;
+		site.totalObjects += sampledObjects;
+		site.totalBytes += sampledBytes;
+
+		handle->sampleSite = (UInt16)(siteIndex + 1);
+	}
+
+	void HeapProfiler::RecordDeallocation(Handle* handle)
+	{
+		AllocationSite& site = m_Sites[handle->sampleSite - 1];
+		UInt64 sampledBytes = GetSampledBytes(handle);
+		UInt64 sampledObjects =
+			handle->byteSize ? sampledBytes / handle->byteSize : 1;
+		site.liveObjects -= sampledObjects;
+		site.liveBytes -= sampledBytes;
+
+		handle->sampleSite = 0;
+	}
+
+	PtrSize HeapProfiler::GetSampledLiveBytes()
+	{
+		if (!m_Sites)
+		{
+			return 0;
+		}
+
+		PtrSize liveBytes = 0;
+		for (UInt32 i = 0; i < m_SiteTableLength; ++i)
+		{
+			liveBytes += m_Sites[i].liveBytes;
+		}
+		return liveBytes;
+	}
+
+	void HeapProfiler::WriteProfile(const char* filePath)
+	{
+		HANDLE fileHandle = CreateFileA(filePath, GENERIC_WRITE, 0, 0, CREATE_ALWAYS,
+			FILE_ATTRIBUTE_NORMAL, NULL);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			SoulLogError("Failed to open heap profile %s.", filePath);
+			return;
+		}
+
+		/*
+		Header containing the totals across all sites.
+		*/
+		UInt64 liveObjects = 0;
+		UInt64 liveBytes = 0;
+		UInt64 totalObjects = 0;
+		UInt64 totalBytes = 0;
+		for (UInt32 i = 0; m_Sites && i < m_SiteTableLength; ++i)
+		{
+			liveObjects += m_Sites[i].liveObjects;
+			liveBytes += m_Sites[i].liveBytes;
+			totalObjects += m_Sites[i].totalObjects;
+			totalBytes += m_Sites[i].totalBytes;
+		}
+
+		char line[512];
+		DWORD bytesWritten;
+		int lineLength = snprintf(line, sizeof(line),
+			"heap profile: %llu: %llu [%llu: %llu] @ heapprofile\n",
+			liveObjects, liveBytes, totalObjects, totalBytes);
+		WriteFile(fileHandle, line, (DWORD)lineLength, &bytesWritten, 0);
+
+		/*
+		One line per call site, followed by its backtrace.
+		*/
+		for (UInt32 i = 0; m_Sites && i < m_SiteTableLength; ++i)
+		{
+			AllocationSite& site = m_Sites[i];
+			if (!site.frameCount)
+			{
+				continue;
+			}
+
+			lineLength = snprintf(line, sizeof(line), "%llu: %llu [%llu: %llu] @",
+				site.liveObjects, site.liveBytes, site.totalObjects, site.totalBytes);
+			for (UInt32 j = 0; j < site.frameCount; ++j)
+			{
+				lineLength += snprintf(line + lineLength, sizeof(line) - lineLength,
+					" 0x%llx", (UInt64)site.frames[j]);
+			}
+			lineLength += snprintf(line + lineLength, sizeof(line) - lineLength, "\n");
+			WriteFile(fileHandle, line, (DWORD)lineLength, &bytesWritten, 0);
+		}
+
+		/*
+		The loaded modules in /proc/self/maps format, so pprof can map the
+		frames back to symbols.
+		*/
+		lineLength = snprintf(line, sizeof(line), "\nMAPPED_LIBRARIES:\n");
+		WriteFile(fileHandle, line, (DWORD)lineLength, &bytesWritten, 0);
+
+		HANDLE process = GetCurrentProcess();
+		HMODULE modules[256];
+		DWORD moduleBytes;
+		if (EnumProcessModules(process, modules, sizeof(modules), &moduleBytes))
+		{
+			UInt32 moduleCount = (UInt32)(moduleBytes / sizeof(HMODULE));
+			if (moduleCount > 256)
+			{
+				moduleCount = 256;
+			}
+
+			for (UInt32 i = 0; i < moduleCount; ++i)
+			{
+				MODULEINFO moduleInfo;
+				char modulePath[MAX_PATH];
+				if (!GetModuleInformation(process, modules[i], &moduleInfo, sizeof(moduleInfo)) ||
+					!GetModuleFileNameExA(process, modules[i], modulePath, MAX_PATH))
+				{
+					continue;
+				}
+
+				UInt64 moduleStart = (UInt64)moduleInfo.lpBaseOfDll;
+				lineLength = snprintf(line, sizeof(line),
+					"%08llx-%08llx r-xp 00000000 00:00 0 %s\n", moduleStart,
+					moduleStart + moduleInfo.SizeOfImage, modulePath);
+				WriteFile(fileHandle, line, (DWORD)lineLength, &bytesWritten, 0);
+			}
+		}
+
+		CloseHandle(fileHandle);
+	}
+
+	void HeapProfiler::Shutdown()
+	{
+		free(m_Sites);
+		m_Sites = nullptr;
+		m_SampleRate = 0;
+	}
+
+	Int32 HeapProfiler::FindSite(void** frames, UInt32 frameCount, UInt32 hash)
+	{
+		/*
+		Linear probe from the hash until we find the site or an empty slot.
+		*/
+		for (UInt32 i = 0; i < m_SiteTableLength; ++i)
+		{
+			UInt32 siteIndex = (hash + i) % m_SiteTableLength;
+			AllocationSite& site = m_Sites[siteIndex];
+
+			if (!site.frameCount)
+			{
+				memcpy(site.frames, frames, sizeof(void*) * frameCount);
+				site.frameCount = frameCount;
+				site.hash = hash;
+				return (Int32)siteIndex;
+			}
+
+			if (site.hash == hash && site.frameCount == frameCount &&
+				memcmp(site.frames, frames, sizeof(void*) * frameCount) == 0)
+			{
+				return (Int32)siteIndex;
+			}
+		}
+
+		return -1;
+	}
+
+	UInt64 HeapProfiler::GetSampledBytes(Handle* handle)
+	{
+		/*
+		A sample stands in for every byte allocated since the last one, so
+		small allocations are weighted up to the sample rate.
+		*/
+		return handle->byteSize > m_WeightRate ? handle->byteSize : m_WeightRate;
+	}
+}
\ No newline at end of file
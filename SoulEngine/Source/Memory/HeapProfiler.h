@@ -0,0 +1,128 @@
+/*
+Samples MemoryManager allocations and aggregates them by call site.
+@file HeapProfiler.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <UtilsLib/CommonTypes.h>
+
+namespace Soul
+{
+	struct Handle;
+
+	/*
+	A sampled allocation call site.
+	*/
+	struct AllocationSite
+	{
+		void* frames[16]; // Return addresses of the captured backtrace.
+		UInt32 frameCount; // Number of captured frames.
+		UInt32 hash; // Hash of the captured frames.
+		UInt64 liveObjects; // Estimated number of live allocations from this site.
+		UInt64 liveBytes; // Estimated number of live bytes from this site.
+		UInt64 totalObjects; // Estimated number of allocations ever made from this site.
+		UInt64 totalBytes; // Estimated number of bytes ever allocated from this site.
+	};
+
+	/*
+	A singleton heap profiler used by the MemoryManager. Sampling is off by
+	default; call SetSampleRate() with a non-zero rate to capture a backtrace
+	once every rate bytes allocated. Each sample is weighted to stand in for the
+	bytes that were skipped, and live bytes are tracked per call site until the
+	sampled allocation is freed. The rate should only be changed while no
+	sampled allocations are alive, otherwise their weights will be off.
+
+	WriteProfile() dumps the sites in the legacy text heap profile format
+	understood by pprof and other heap profile viewers, followed by the
+	process's module map so the frames can be symbolized.
+	*/
+	class HeapProfiler
+	{
+	public:
+
+		/*
+		Sets how many bytes are allocated, on average, between samples. A rate
+		of zero turns sampling off.
+
+		@param sampleRate - Number of bytes between samples.
+		*/
+		static void SetSampleRate(PtrSize sampleRate);
+
+		/*
+		Returns whether allocations are currently being sampled.
+
+		@return True if the sample rate is non-zero.
+		*/
+		static bool IsSampling() { return m_SampleRate != 0; }
+
+		/*
+		Counts the provided allocation towards the next sample, capturing its
+		call site if it is sampled.
+
+		@param handle - The handle of the new allocation.
+		*/
+		static void RecordAllocation(Handle* handle);
+
+		/*
+		Removes a sampled allocation from its call site's live totals.
+
+		@param handle - The handle of the sampled allocation being freed.
+		*/
+		static void RecordDeallocation(Handle* handle);
+
+		/*
+		Returns the estimated number of live bytes across all sampled sites.
+
+		@return PtrSize containing the estimated live bytes.
+		*/
+		static PtrSize GetSampledLiveBytes();
+
+		/*
+		Writes every sampled call site to the provided file in the text heap
+		profile format.
+
+		@param filePath - Path of the file to write the profile to.
+		*/
+		static void WriteProfile(const char* filePath);
+
+		/*
+		Frees the memory used by the call site table.
+		*/
+		static void Shutdown();
+
+		HeapProfiler() = delete;
+
+	private:
+		/*
+		Finds the call site with the provided frames, or adds it to the table.
+
+		@param frames - The captured return addresses.
+
+		@param frameCount - Number of captured return addresses.
+
+		@param hash - Hash of the captured return addresses.
+
+		@return Index of the call site, or -1 if the table is full.
+		*/
+		static Int32 FindSite(void** frames, UInt32 frameCount, UInt32 hash);
+
+		/*
+		Returns how many bytes a sample of the provided allocation stands in for.
+
+		@param handle - The handle of the sampled allocation.
+
+		@return UInt64 containing the weighted number of bytes.
+		*/
+		static UInt64 GetSampledBytes(Handle* handle);
+
+	private:
+		static PtrSize m_SampleRate; // Bytes between samples, 0 when disabled.
+		static PtrSize m_WeightRate; // Last non-zero sample rate, used to weight samples.
+		static Int64 m_BytesUntilSample; // Bytes left to allocate before the next sample.
+		static AllocationSite* m_Sites; // Open-addressed table of call sites.
+		static UInt32 m_SiteTableLength; // Maximum number of call sites.
+	};
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 Reserves an initial amount of memory for the engine to be allocated as needed.
 @file MemoryManager.cpp
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #include "MemoryManager.h"
@@ -10,35 +10,61 @@ Reserves an initial amount of memory for the engine to be allocated as needed.
 #include <Memory/UniqueHandle.h>
 #include <UtilsLib/Logger.h>
 
+#include <Windows.h>
+
 namespace Soul
 {
 	Byte* MemoryManager::m_MemoryStart;
 	Byte* MemoryManager::m_AddressableMemoryStart;
 	Byte* MemoryManager::m_MemoryEnd;
 	ByteCount MemoryManager::m_MemorySize;
-	UInt32 MemoryManager::m_HandleTableLength = 512;
+	UInt32 MemoryManager::m_HandleTableLength;
 	Handle* MemoryManager::m_HandleTableStart;
 	Handle* MemoryManager::m_FirstHandle;
+	Handle* MemoryManager::m_FirstLargeHandle;
+	HandleTableSize MemoryManager::m_HandleCount;
+	HandleTableSize MemoryManager::m_PeakHandleCount;
+	ByteCount MemoryManager::m_ArenaAllocatedBytes;
+	ByteCount MemoryManager::m_PeakArenaBytes;
+	ByteCount MemoryManager::m_LargeAllocationThreshold;
+	ByteCount MemoryManager::m_LargeAllocatedBytes;
+	ByteCount MemoryManager::m_PurgeableBudget;
+	ByteCount MemoryManager::m_PurgeableBytes;
+	UInt64 MemoryManager::m_PurgeClock;
 	Byte* MemoryManager::m_VolatileMemoryStart;
 	Byte* MemoryManager::m_VolatileMemoryEnd; 
 	ByteCount MemoryManager::m_VolatileMemorySize;
 	Byte* MemoryManager::m_VolatileNext;
+	ByteCount MemoryManager::m_PeakVolatileBytes;
 	UInt8 MemoryManager::m_FrameCounter;
+	UInt64 MemoryManager::m_FrameIndex;
 	bool MemoryManager::m_IsSetup = false;
 
-	void MemoryManager::StartUp(ByteCount byteSize, ByteCount volatileByteSize)
+	void MemoryManager::StartUp(ByteCount byteSize, ByteCount volatileByteSize,
+		HandleTableSize handleTableLength, ByteCount largeAllocationThreshold)
 	{
 		Assert(!m_IsSetup);
 
 		/*
 		Allocate main memory.
 		*/
+		m_HandleTableLength = handleTableLength;
 		m_MemorySize = byteSize - sizeof(Handle) * m_HandleTableLength;
 		m_MemoryStart = (Byte*)malloc(m_MemorySize);
 		m_MemoryEnd = m_MemoryStart + m_MemorySize;
 		m_HandleTableStart = (Handle*)m_MemoryStart;
 		m_FirstHandle = nullptr;
 		m_AddressableMemoryStart = (Byte*)(m_HandleTableStart + m_HandleTableLength);
+		m_FirstLargeHandle = nullptr;
+		m_LargeAllocationThreshold = largeAllocationThreshold;
+		m_LargeAllocatedBytes = 0;
+		m_HandleCount = 0;
+		m_PeakHandleCount = 0;
+		m_ArenaAllocatedBytes = 0;
+		m_PeakArenaBytes = 0;
+		m_PurgeableBudget = (ByteCount)-1;
+		m_PurgeableBytes = 0;
+		m_PurgeClock = 0;
 
 		/*
 		Allocate volatile storage.
@@ -47,7 +73,9 @@ namespace Soul
 		m_VolatileMemoryStart = (Byte*)malloc(m_VolatileMemorySize);
 		m_VolatileMemoryEnd = m_VolatileMemoryStart + m_VolatileMemorySize;
 		m_VolatileNext = m_VolatileMemoryStart;
+		m_PeakVolatileBytes = 0;
 		m_FrameCounter = 0;
+		m_FrameIndex = 0;
 
 		m_IsSetup = true;
 
@@ -58,6 +86,20 @@ namespace Soul
 	void MemoryManager::Shutdown()
 	{
 		Assert(m_IsSetup);
+
+		/*
+		Return any large blocks that are still alive to the OS.
+		*/
+		Handle* largeHandle = m_FirstLargeHandle;
+		while (largeHandle)
+		{
+			VirtualFree(largeHandle->location, 0, MEM_RELEASE);
+			largeHandle = largeHandle->nextHandle;
+		}
+		m_FirstLargeHandle = nullptr;
+		m_LargeAllocatedBytes = 0;
+
+		HeapProfiler::Shutdown();
 		free(m_MemoryStart);
 		m_MemoryStart = nullptr;
 		m_AddressableMemoryStart = nullptr;
@@ -70,14 +112,22 @@ namespace Soul
 
 	void MemoryManager::IncrementFrameCounter()
 	{
+		++m_FrameIndex;
+
 		if (++m_FrameCounter >= 2)
 		{
+			m_PeakVolatileBytes = GetPeakVolatileBytes();
 			m_FrameCounter = 0;
 			memset(m_VolatileMemoryStart, 0, m_VolatileMemorySize);
 			m_VolatileNext = m_VolatileMemoryStart;
 		}
 	}
 
+	UInt64 MemoryManager::GetFrameIndex()
+	{
+		return m_FrameIndex;
+	}
+
 	void MemoryManager::Defragment(UInt8 blockCount)
 	{
 		Assert(m_IsSetup);
@@ -106,24 +156,56 @@ namespace Soul
 		}
 	}
 
-	ByteCount MemoryManager::GetTotalAllocatedBytes()
+	void MemoryManager::SetLargeAllocationThreshold(ByteCount largeAllocationThreshold)
+	{
+		m_LargeAllocationThreshold = largeAllocationThreshold;
+	}
+
+	void MemoryManager::SetPurgeableBudget(ByteCount purgeableBudget)
 	{
 		Assert(m_IsSetup);
 
-		ByteCount totalBytes = 0;
-		Handle* currentHandle = m_FirstHandle;
-		while (currentHandle)
+		m_PurgeableBudget = purgeableBudget;
+		while (m_PurgeableBytes > m_PurgeableBudget && PurgeLeastRecentlyUsed(false))
 		{
-			totalBytes += currentHandle->byteSize;
-			currentHandle = currentHandle->nextHandle;
 		}
-		return totalBytes;
+	}
+
+	void MemoryManager::Touch(Handle* handle)
+	{
+		handle->lastTouched = ++m_PurgeClock;
+	}
+
+	ByteCount MemoryManager::GetTotalAllocatedBytes()
+	{
+		Assert(m_IsSetup);
+		return m_ArenaAllocatedBytes + m_LargeAllocatedBytes;
+	}
+
+	ByteCount MemoryManager::GetPeakAllocatedBytes()
+	{
+		Assert(m_IsSetup);
+		return m_PeakArenaBytes;
+	}
+
+	ByteCount MemoryManager::GetPeakVolatileBytes()
+	{
+		Assert(m_IsSetup);
+
+		ByteCount volatileBytes = ByteDistance(m_VolatileMemoryStart, m_VolatileNext);
+		return volatileBytes > m_PeakVolatileBytes ? volatileBytes : m_PeakVolatileBytes;
+	}
+
+	HandleTableSize MemoryManager::GetPeakHandleCount()
+	{
+		Assert(m_IsSetup);
+		return m_PeakHandleCount;
 	}
 
 	ByteCount MemoryManager::GetTotalFreeBytes()
 	{
 		Assert(m_IsSetup);
-		return m_MemorySize - GetTotalAllocatedBytes();
+		return m_MemorySize - m_ArenaAllocatedBytes;
 	}
 
 	void MemoryManager::PrintMemory()
@@ -170,11 +252,108 @@ namespace Soul
 		return handleCount;
 	}
 
+	Handle* MemoryManager::FindFreeHandle(Handle* startHandle)
+	{
+		Handle* handleTableEnd = m_HandleTableStart + m_HandleTableLength;
+		Handle* currentHandle = startHandle;
+		while (currentHandle < handleTableEnd && currentHandle->isUsed)
+		{
+			++currentHandle;
+		}
+
+		// Running out of handles means the table is too small for this run.
+		Assert(currentHandle < handleTableEnd);
+		return currentHandle;
+	}
+
+	Handle* MemoryManager::SetupLargeHandle(ByteCount byteSize, ArraySize count)
+	{
+		void* largeBlock =
+			VirtualAlloc(nullptr, byteSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		if (!largeBlock)
+		{
+			SoulLogError("Failed to allocate large block of %lld bytes.", byteSize);
+			Assert(false);
+		}
+
+		Handle* largeHandle = FindFreeHandle(m_HandleTableStart);
+		largeHandle->nextHandle = m_FirstLargeHandle;
+		largeHandle->location = largeBlock;
+		largeHandle->byteSize = byteSize;
+		largeHandle->elementCount = count;
+		largeHandle->isUsed = true;
+		largeHandle->isCopyable = true;
+		largeHandle->isLargeBlock = true;
+		largeHandle->sampleSite = 0;
+		m_FirstLargeHandle = largeHandle;
+		m_LargeAllocatedBytes += byteSize;
+		if (++m_HandleCount > m_PeakHandleCount)
+		{
+			m_PeakHandleCount = m_HandleCount;
+		}
+
+		if (HeapProfiler::IsSampling())
+		{
+			HeapProfiler::RecordAllocation(largeHandle);
+		}
+
+		return largeHandle;
+	}
+
 	void MemoryManager::DeleteHandle(Handle* handlePointer)
 	{
-		if (handlePointer == m_FirstHandle)
+		// Purged handles have already given their memory back.
+		if (handlePointer->location)
+		{
+			ReleaseBlock(handlePointer);
+		}
+
+		/*
+		Free the handle
+		*/
+		--m_HandleCount;
+		memset(handlePointer, 0, sizeof(Handle));
+	}
+
+	void MemoryManager::ReleaseBlock(Handle* handlePointer)
+	{
+		if (handlePointer->isPurgeable)
+		{
+			m_PurgeableBytes -= handlePointer->byteSize;
+		}
+
+		if (handlePointer->sampleSite)
+		{
+			HeapProfiler::RecordDeallocation(handlePointer);
+		}
+
+		if (handlePointer->isLargeBlock)
+		{
+			/*
+			Unlink the handle from the large block list and give the pages back
+			to the OS.
+			*/
+			if (handlePointer == m_FirstLargeHandle)
+			{
+				m_FirstLargeHandle = handlePointer->nextHandle;
+			}
+			else
+			{
+				Handle* currentHandle = m_FirstLargeHandle;
+				while (currentHandle->nextHandle != handlePointer)
+				{
+					currentHandle = currentHandle->nextHandle;
+				}
+				currentHandle->nextHandle = handlePointer->nextHandle;
+			}
+
+			m_LargeAllocatedBytes -= handlePointer->byteSize;
+			VirtualFree(handlePointer->location, 0, MEM_RELEASE);
+		}
+		else if (handlePointer == m_FirstHandle)
 		{
 			m_FirstHandle = handlePointer->nextHandle;
+			m_ArenaAllocatedBytes -= handlePointer->byteSize;
 		}
 		else
 		{
@@ -192,12 +371,70 @@ namespace Soul
 			Patch the list around the removed handle.
 			*/
 			currentHandle->nextHandle = currentHandle->nextHandle->nextHandle;
+			m_ArenaAllocatedBytes -= handlePointer->byteSize;
+		}
+	}
+
+	void MemoryManager::LinkHandles(Handle* previousHandle, Handle* firstHandle,
+		Handle* lastHandle)
+	{
+		if (previousHandle)
+		{
+			lastHandle->nextHandle = previousHandle->nextHandle;
+			previousHandle->nextHandle = firstHandle;
+		}
+		else
+		{
+			// These are the first handles of the table
+			lastHandle->nextHandle = m_FirstHandle;
+			m_FirstHandle = firstHandle;
+		}
+	}
+
+	void MemoryManager::DeleteMarkedHandles(ArraySize handleCount)
+	{
+		Handle* previousHandle = nullptr;
+		Handle* currentHandle = m_FirstHandle;
+		ArraySize deletedHandles = 0;
+		while (currentHandle && deletedHandles < handleCount)
+		{
+			Handle* nextHandle = currentHandle->nextHandle;
+			if (!currentHandle->isUsed)
+			{
+				/*
+				Patch the list around the removed handle and free it.
+				*/
+				if (previousHandle)
+				{
+					previousHandle->nextHandle = nextHandle;
+				}
+				else
+				{
+					m_FirstHandle = nextHandle;
+				}
+
+				if (currentHandle->isPurgeable)
+				{
+					m_PurgeableBytes -= currentHandle->byteSize;
+				}
+
+				if (currentHandle->sampleSite)
+				{
+					HeapProfiler::RecordDeallocation(currentHandle);
+				}
+
+				m_ArenaAllocatedBytes -= currentHandle->byteSize;
+				--m_HandleCount;
+				memset(currentHandle, 0, sizeof(Handle));
+				++deletedHandles;
+			}
+			else
+			{
+				previousHandle = currentHandle;
+			}
+
+			currentHandle = nextHandle;
 		}
-		
-		/*
-		Free the handle
-		*/
-		memset(handlePointer, 0, sizeof(Handle));
 	}
 
 	void* MemoryManager::FindFirstFreeMemoryBlock(ByteCount requestedSize,
@@ -211,6 +448,16 @@ namespace Soul
 			return m_AddressableMemoryStart;
 		}
 
+		/*
+		Check the space before the first handle, which opens up when the first
+		block is freed or purged.
+		*/
+		if (ByteDistance(m_AddressableMemoryStart, m_FirstHandle->location) >=
+			requestedSize)
+		{
+			return m_AddressableMemoryStart;
+		}
+
 		Handle* currentHandle = m_FirstHandle;
 		Handle* nextHandle = currentHandle->nextHandle;
 
@@ -244,6 +491,11 @@ namespace Soul
 			(*previousHandleOut) = currentHandle;
 			return endOfBlock;
 		}
+		else if (PurgeLeastRecentlyUsed(true))
+		{
+			// Try again with the space freed up by the purged block.
+			return FindFirstFreeMemoryBlock(requestedSize, previousHandleOut);
+		}
 		else
 		{
 			SoulLogError("Ran out of memory.");
@@ -252,11 +504,70 @@ namespace Soul
 		}
 	}
 
+	bool MemoryManager::PurgeLeastRecentlyUsed(bool arenaOnly)
+	{
+		/*
+		Find the purgeable block that was touched the longest time ago.
+		*/
+		Handle* oldestHandle = nullptr;
+		Handle* currentHandle = m_FirstHandle;
+		while (currentHandle)
+		{
+			if (currentHandle->isPurgeable &&
+				(!oldestHandle || currentHandle->lastTouched < oldestHandle->lastTouched))
+			{
+				oldestHandle = currentHandle;
+			}
+			currentHandle = currentHandle->nextHandle;
+		}
+
+		currentHandle = arenaOnly ? nullptr : m_FirstLargeHandle;
+		while (currentHandle)
+		{
+			if (currentHandle->isPurgeable &&
+				(!oldestHandle || currentHandle->lastTouched < oldestHandle->lastTouched))
+			{
+				oldestHandle = currentHandle;
+			}
+			currentHandle = currentHandle->nextHandle;
+		}
+
+		if (!oldestHandle)
+		{
+			return false;
+		}
+
+		/*
+		Free the memory but keep the Handle, so the UniqueHandle that owns it
+		sees it was purged wherever it has been moved to. The Handle is freed
+		once that UniqueHandle is deallocated or destroyed.
+		*/
+		PurgeCallback callback = oldestHandle->purgeCallback;
+		void* owner = oldestHandle->purgeOwner;
+		ReleaseBlock(oldestHandle);
+		oldestHandle->nextHandle = nullptr;
+		oldestHandle->location = nullptr;
+		oldestHandle->byteSize = 0;
+		oldestHandle->elementCount = 0;
+		oldestHandle->isPurgeable = false;
+		oldestHandle->purgeCallback = nullptr;
+		oldestHandle->purgeOwner = nullptr;
+		oldestHandle->sampleSite = 0;
+
+		if (callback)
+		{
+			callback(owner);
+		}
+
+		return true;
+	}
+
 	void MemoryManager::MoveHandle(Handle* handle, void* newLocation)
 	{
 		Assert(handle->isCopyable);
 
-		memcpy(newLocation, handle->location, handle->byteSize);
+		// Blocks slide down during defragmentation and may overlap themselves.
+		memmove(newLocation, handle->location, handle->byteSize);
 		handle->location = newLocation;
 	}
 }
\ No newline at end of file
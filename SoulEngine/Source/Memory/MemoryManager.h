@@ -2,20 +2,24 @@
 Reserves an initial amount of memory for the engine to be allocated as needed.
 @file MemoryManager.h
 @author Jacob Peterson
-@edited 4/18/21
+@edited 10/19/26
 */
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <new>
+#include <type_traits>
 #include <utility>
 
+#include <Memory/HeapProfiler.h>
 #include <UtilsLib/CommonTypes.h>
 #include <UtilsLib/Macros.h>
 
 typedef PtrSize ByteCount;
 typedef UInt32 HandleTableSize;
+typedef void (*PurgeCallback)(void* owner);
 
 namespace Soul
 {
@@ -23,16 +27,24 @@ namespace Soul
 	class UniqueHandle;
 
 	/*
-	Returned when allocating memory. Should be used in a UniqueHandle object.
+	Returned when allocating memory. Should be used in a UniqueHandle or
+	SharedHandle object.
 	*/
 	struct Handle
 	{
 		Handle* nextHandle; // The handle closest to this one.
-		void* location; // Location that this handle points to in the memory arena.
+		void* location; // Location that this handle points to in the memory arena, or nullptr once purged.
 		ByteCount byteSize; // Size of the memory block that this handle points to.
 		ArraySize elementCount; // Number of elements allocated in the memory block.
 		bool isUsed; // Whether this handle is currently in use.
 		bool isCopyable; // Whether the data under this handle can be trivially copied.
+		bool isLargeBlock; // Whether this handle owns its own OS pages outside the arena.
+		bool isPurgeable; // Whether this memory can be evicted under memory pressure.
+		PurgeCallback purgeCallback; // Called to tell the owner its purgeable memory was released.
+		void* purgeOwner; // Passed to the purge callback.
+		UInt64 lastTouched; // Purge clock value when this memory was last used.
+		UInt16 sampleSite; // Heap profiler site index + 1, or 0 if not sampled.
+		std::atomic<UInt32> referenceCount; // Number of SharedHandles that own this handle.
 	};
 
 	/*
@@ -43,7 +55,18 @@ namespace Soul
 	To partition memory for use, call Allocate<T>(...) or AllocateArray<T> with
 	the desired type inserted into the template. This will return a new
 	UniqueHandle which can then be used to access the memory block that was
-	allocated for the object.
+	allocated for the object. Many arrays can be allocated and freed at once
+	with AllocateBatch<T> and DeallocateBatch<T>.
+
+	Single allocations at or above the large allocation threshold bypass the
+	arena and get their own pages from the OS, which are returned as soon as
+	they are deallocated. These blocks still use the Handle table, but never
+	fragment the arena and are never defragmented.
+
+	Caches can be allocated with AllocatePurgeable<T>. When the arena runs out
+	of space, or the purgeable budget is exceeded, the least recently touched
+	purgeable blocks are freed before the allocation fails, and their
+	UniqueHandles stop being valid.
 
 	For debugging purposes, the GetTotalAllocatedBytes(), GetTotalFreeBytes(),
 	and CountFragments() functions can be used to query the current usage of
@@ -61,8 +84,17 @@ namespace Soul
 
 		@param volatileByteSize - The number of bytes to reserve for the
 		                            the volatile memory storage.
+
+		@param handleTableLength - The maximum number of handles that can be
+		                             alive at once.
+
+		@param largeAllocationThreshold - Allocations of at least this many
+		                                    bytes are given their own pages
+		                                    outside the arena.
 		*/
-		static void StartUp(ByteCount byteSize, ByteCount volatileByteSize);
+		static void StartUp(ByteCount byteSize, ByteCount volatileByteSize,
+			HandleTableSize handleTableLength = 4096,
+			ByteCount largeAllocationThreshold = Megabytes(1));
 
 		/*
 		Shuts down the MemoryManager and frees all its memory.
@@ -81,7 +113,9 @@ namespace Soul
 		static UniqueHandle<T> Allocate(Args&&... args);
 
 		/*
-		Attempts to allocate the provided amount of memory in the arena.
+		Attempts to allocate the provided amount of memory in the arena. Arrays
+		of trivially default constructible types are left uninitialized, all
+		other types are zeroed so they can be safely assigned into.
 
 		@param count - The number of elements to reserve memory for in the
 		                 array.
@@ -92,6 +126,44 @@ namespace Soul
 		template <class T>
 		static UniqueHandle<T> AllocateArray(ArraySize count);
 
+		/*
+		Attempts to allocate an array that can be evicted under memory pressure.
+		When evicted, the MemoryManager frees the memory itself, without
+		calling destructors, and the UniqueHandle's IsValid() returns false.
+		The UniqueHandle still needs to be deallocated or destroyed as usual.
+		The callback is then called with the owner, only to let it know.
+
+		@param count - The number of elements to reserve memory for in the
+		                 array.
+
+		@param callback - Called after the memory has been purged, or nullptr.
+
+		@param owner - Passed to the callback. Must stay at the same address
+		               for as long as the memory is allocated, so it shouldn't
+		               be the UniqueHandle itself, which may be moved.
+
+		@return UniqueHandle<T> containing the handle that points to the newly
+		                        allocated memory.
+		*/
+		template <class T>
+		static UniqueHandle<T> AllocatePurgeable(ArraySize count,
+			PurgeCallback callback, void* owner);
+
+		/*
+		Allocates several arrays in a single search of the memory arena. The
+		arrays are placed contiguously, in the order they were requested.
+
+		@param batchSize - The number of arrays to allocate.
+
+		@param counts - The number of elements to reserve for each array.
+
+		@param handlesOut - Array of batchSize UniqueHandles that receive the
+		                     newly allocated memory.
+		*/
+		template <class T>
+		static void AllocateBatch(ArraySize batchSize, const ArraySize* counts,
+			UniqueHandle<T>* handlesOut);
+
 		/*
 		Allocates memory in the volatile memory arena. This memory gets cleared
 		every other frame.
@@ -103,6 +175,22 @@ namespace Soul
 		template <class T>
 		static T* AllocateVolatile(ArraySize count = 1);
 
+		/*
+		Attempts to grow a volatile allocation in place. This only succeeds
+		if the allocation is the most recent one in the volatile arena and
+		there is room left in the arena.
+
+		@param memory - Pointer previously returned by AllocateVolatile().
+
+		@param oldCount - Number of elements currently allocated to memory.
+
+		@param newCount - Number of elements memory should be grown to.
+
+		@return Whether the allocation was grown.
+		*/
+		template <class T>
+		static bool ExtendVolatile(T* memory, ArraySize oldCount, ArraySize newCount);
+
 		/*
 		Calls the destructor and frees the memory for every object allocated to
 		the provided handle.
@@ -112,12 +200,33 @@ namespace Soul
 		template <class T>
 		static void Deallocate(Handle& handle);
 
+		/*
+		Calls the destructor and frees the memory for every provided
+		UniqueHandle, unlinking all of them in a single pass over the handle
+		list. The UniqueHandles are left invalid.
+
+		@param handles - Array of UniqueHandles whose memory needs to be freed.
+
+		@param handleCount - The number of UniqueHandles in the array.
+		*/
+		template <class T>
+		static void DeallocateBatch(UniqueHandle<T>* handles, ArraySize handleCount);
+
 		/*
 		Increases the frame memory counter. Once the frame memory counter
 		reaches two, the memory is cleared.
 		*/
 		static void IncrementFrameCounter();
 
+		/*
+		Returns the number of times IncrementFrameCounter() has been called
+		since StartUp(). Used by frame containers to detect that they have
+		outlived the frame they were created in.
+
+		@return UInt64 containing the current frame index.
+		*/
+		static UInt64 GetFrameIndex();
+
 		/*
 		Attempts to defragment the provided number of blocks to keep memory
 		contiguous and cache-friendly.
@@ -126,9 +235,35 @@ namespace Soul
 		*/
 		static void Defragment(UInt8 blockCount);
 
+		/*
+		Sets the maximum number of bytes that purgeable memory can use before
+		the least recently touched blocks get evicted. Defaults to no limit.
+
+		@param purgeableBudget - The maximum number of purgeable bytes.
+		*/
+		static void SetPurgeableBudget(ByteCount purgeableBudget);
+
+		/*
+		Marks the memory under the provided handle as recently used, so it is
+		among the last to be purged.
+
+		@param handle - The handle whose memory was used.
+		*/
+		static void Touch(Handle* handle);
+
+		/*
+		Sets the minimum size of an allocation that bypasses the arena.
+
+		@param largeAllocationThreshold - Allocations of at least this many
+		                                    bytes are given their own pages
+		                                    outside the arena.
+		*/
+		static void SetLargeAllocationThreshold(ByteCount largeAllocationThreshold);
+
 		/*
 		Returns the total number of bytes that have been allocated by the
-		MemoryManager (this does not include the memory used by the Handle table)
+		MemoryManager, including large blocks (this does not include the memory
+		used by the Handle table)
 
 		@return ByteCount containing the number of allocated bytes in this
 		        MemoryManager.
@@ -136,7 +271,32 @@ namespace Soul
 		static ByteCount GetTotalAllocatedBytes();
 
 		/*
-		Returns the total number of bytes that are free in the MemoryManager.
+		Returns the highest number of bytes that have been allocated in the
+		arena at once since StartUp().
+
+		@return ByteCount containing the peak number of arena bytes.
+		*/
+		static ByteCount GetPeakAllocatedBytes();
+
+		/*
+		Returns the highest number of volatile bytes used within a single
+		volatile memory cycle since StartUp().
+
+		@return ByteCount containing the peak number of volatile bytes.
+		*/
+		static ByteCount GetPeakVolatileBytes();
+
+		/*
+		Returns the highest number of handles that have been alive at once
+		since StartUp().
+
+		@return HandleTableSize containing the peak number of handles.
+		*/
+		static HandleTableSize GetPeakHandleCount();
+
+		/*
+		Returns the total number of bytes that are free in the MemoryManager's
+		arena.
 
 		@return ByteCount containing the number of free bytes in this
 		        MemoryManager.
@@ -168,10 +328,18 @@ namespace Soul
 		*/
 		static HandleTableSize GetNodeCount();
 
+		/*
+		Returns the first Handle in the table that is not in use.
+
+		@param startHandle - The Handle to start searching from.
+
+		@return Pointer to the first unused Handle at or after startHandle.
+		*/
+		static Handle* FindFreeHandle(Handle* startHandle);
+
 		/*
 		Creates a new handle pointing to a memory block that can hold the
-		requested amount of memory. If this is not meant for an array, the
-		element can be constructed in place with the passed arguments.
+		requested amount of memory. The memory block is left uninitialized.
 
 		@param count - The number of elements to reserve space for at the
 		                 new block of memory.
@@ -179,6 +347,54 @@ namespace Soul
 		template <class T>
 		static Handle* SetupNewHandle(ArraySize count);
 
+		/*
+		Creates a new handle pointing to a memory block with its own pages
+		outside of the arena. The memory block is left uninitialized.
+
+		@param byteSize - The number of bytes to reserve.
+
+		@param count - The number of elements the block holds.
+		*/
+		static Handle* SetupLargeHandle(ByteCount byteSize, ArraySize count);
+
+		/*
+		Creates several new handles pointing to contiguous memory blocks. The
+		memory blocks are left uninitialized.
+
+		@param batchSize - The number of handles to create.
+
+		@param counts - The number of elements to reserve space for in each
+		                  block.
+
+		@return Pointer to the first new handle. The rest follow it in the
+		        handle list.
+		*/
+		template <class T>
+		static Handle* SetupNewHandles(ArraySize batchSize, const ArraySize* counts);
+
+		/*
+		Links an already chained run of new handles into the handle list just
+		after the provided handle.
+
+		@param previousHandle - The handle just before the new handles, or
+		                          nullptr if the list is empty.
+
+		@param firstHandle - The first handle of the new chain.
+
+		@param lastHandle - The last handle of the new chain.
+		*/
+		static void LinkHandles(Handle* previousHandle, Handle* firstHandle,
+			Handle* lastHandle);
+
+		/*
+		Calls the destructor for every element in the provided handle's memory
+		block.
+
+		@param handle - The handle whose elements need to be destructed.
+		*/
+		template <class T>
+		static void DestructElements(Handle* handle);
+
 		/*
 		Deletes the provided handle and patches the handle table around it.
 
@@ -186,6 +402,22 @@ namespace Soul
 		*/
 		static void DeleteHandle(Handle* handle);
 
+		/*
+		Unlinks the provided handle and frees its memory block, leaving the
+		handle itself in use.
+
+		@param handle - Pointer to the handle whose memory should be freed.
+		*/
+		static void ReleaseBlock(Handle* handle);
+
+		/*
+		Deletes every handle in the list that has been marked as unused,
+		patching the handle table around them in a single pass.
+
+		@param handleCount - The number of marked handles to delete.
+		*/
+		static void DeleteMarkedHandles(ArraySize handleCount);
+
 		/*
 		Finds the first available memory block that can accomodate the
 		requested byte size.
@@ -198,6 +430,17 @@ namespace Soul
 		static void* FindFirstFreeMemoryBlock(ByteCount requestedSize,
 			Handle** previousHandleOut);
 
+		/*
+		Evicts the least recently touched purgeable block, then calls its purge
+		callback.
+
+		@param arenaOnly - Whether to only consider blocks in the arena.
+
+		@return True if a block was evicted, false if there was nothing to
+		        evict.
+		*/
+		static bool PurgeLeastRecentlyUsed(bool arenaOnly);
+
 		/*
 		Moves the memory pointed to by the provided handle to the new location.
 
@@ -215,12 +458,24 @@ namespace Soul
 		static HandleTableSize m_HandleTableLength; // Maximum amount of handles that can be created.
 		static Handle* m_HandleTableStart; // Start address of handle table.
 		static Handle* m_FirstHandle; // Address to the starting handle of the table.
+		static Handle* m_FirstLargeHandle; // Start of the list of handles to large blocks.
+		static HandleTableSize m_HandleCount; // Number of handles currently in use.
+		static HandleTableSize m_PeakHandleCount; // Highest number of handles in use at once.
+		static ByteCount m_ArenaAllocatedBytes; // Bytes currently allocated in the arena.
+		static ByteCount m_PeakArenaBytes; // Highest number of bytes allocated in the arena at once.
+		static ByteCount m_LargeAllocationThreshold; // Minimum byte size of a large block.
+		static ByteCount m_LargeAllocatedBytes; // Bytes currently held in large blocks.
+		static ByteCount m_PurgeableBudget; // Maximum bytes of purgeable memory.
+		static ByteCount m_PurgeableBytes; // Bytes currently held in purgeable memory.
+		static UInt64 m_PurgeClock; // Incremented every time purgeable memory is touched.
 
 		static Byte* m_VolatileMemoryStart; // Start of volatile partitioned memory.
 		static Byte* m_VolatileMemoryEnd; // End of volatile partitioned memory.
 		static ByteCount m_VolatileMemorySize; // Size of volatile memory.
 		static Byte* m_VolatileNext; // The next address to allocate volatile memory to.
+		static ByteCount m_PeakVolatileBytes; // Highest volatile usage before a clear.
 		static UInt8 m_FrameCounter; // Number of frames since last volatile memory clear.
+		static UInt64 m_FrameIndex; // Number of frames since StartUp().
 
 		static bool m_IsSetup; // Whether this MemoryManager has been initialized yet.
 	};
@@ -242,82 +497,259 @@ namespace Soul
 		Assert(m_IsSetup);
 
 		Handle* newHandle = SetupNewHandle<T>(count);
+
+		/*
+		Objects without a trivial default constructor are expected to be
+		assigned into, so they need to start out zeroed.
+		*/
+		if constexpr (!std::is_trivially_default_constructible<T>::value)
+		{
+			memset(newHandle->location, 0, count * sizeof(T));
+		}
+
+		UniqueHandle<T> uniqueHandle(newHandle);
+		return std::move(uniqueHandle);
+	}
+
+	template <class T>
+	UniqueHandle<T> MemoryManager::AllocatePurgeable(ArraySize count,
+		PurgeCallback callback, void* owner)
+	{
+		static_assert(std::is_trivially_destructible<T>::value,
+			"Purged memory is freed without calling destructors.");
+
+		Assert(m_IsSetup);
+
+		/*
+		Make room in the purgeable budget first.
+		*/
+		ByteCount byteSize = count * sizeof(T);
+		while (m_PurgeableBytes + byteSize > m_PurgeableBudget &&
+			PurgeLeastRecentlyUsed(false))
+		{
+		}
+
+		Handle* newHandle = SetupNewHandle<T>(count);
+		if constexpr (!std::is_trivially_default_constructible<T>::value)
+		{
+			memset(newHandle->location, 0, byteSize);
+		}
+
+		newHandle->isPurgeable = true;
+		newHandle->purgeCallback = callback;
+		newHandle->purgeOwner = owner;
+		newHandle->lastTouched = ++m_PurgeClock;
+		m_PurgeableBytes += byteSize;
+
 		UniqueHandle<T> uniqueHandle(newHandle);
 		return std::move(uniqueHandle);
 	}
 
+	template <class T>
+	void MemoryManager::AllocateBatch(ArraySize batchSize,
+		const ArraySize* counts, UniqueHandle<T>* handlesOut)
+	{
+		Assert(m_IsSetup);
+		Assert(batchSize > 0);
+
+		/*
+		The new handles are linked in order, so walk the chain to hand them out.
+		*/
+		Handle* currentHandle = SetupNewHandles<T>(batchSize, counts);
+		for (ArraySize i = 0; i < batchSize; ++i)
+		{
+			if constexpr (!std::is_trivially_default_constructible<T>::value)
+			{
+				memset(currentHandle->location, 0, counts[i] * sizeof(T));
+			}
+
+			handlesOut[i] = UniqueHandle<T>(currentHandle);
+			currentHandle = currentHandle->nextHandle;
+		}
+	}
+
 	template <class T>
 	static T* MemoryManager::AllocateVolatile(ArraySize count /*=1*/)
 	{
-		Assert(m_VolatileNext + count * sizeof(T) <= m_VolatileMemoryEnd);
+		Byte* alignedNext = (Byte*)(((PtrSize)m_VolatileNext + alignof(T) - 1) &
+			~((PtrSize)alignof(T) - 1));
+		Assert(alignedNext + count * sizeof(T) <= m_VolatileMemoryEnd);
 
-		T* memory = (T*)m_VolatileNext;
-		m_VolatileNext += count * sizeof(T);
+		T* memory = (T*)alignedNext;
+		m_VolatileNext = alignedNext + count * sizeof(T);
 
 		return memory;
 	}
 
+	template <class T>
+	bool MemoryManager::ExtendVolatile(T* memory, ArraySize oldCount,
+		ArraySize newCount)
+	{
+		if ((Byte*)(memory + oldCount) != m_VolatileNext ||
+			(Byte*)(memory + newCount) > m_VolatileMemoryEnd)
+		{
+			return false;
+		}
+
+		m_VolatileNext = (Byte*)(memory + newCount);
+
+		return true;
+	}
+
 	template <class T>
 	void MemoryManager::Deallocate(Handle& handle)
 	{
 		Assert(m_IsSetup);
 
+		DestructElements<T>(&handle);
+		DeleteHandle(&handle);
+	}
+
+	template <class T>
+	void MemoryManager::DeallocateBatch(UniqueHandle<T>* handles,
+		ArraySize handleCount)
+	{
+		Assert(m_IsSetup);
+
 		/*
-		Destruct all elements at the given block
+		Destruct every element before touching the handles. A destructor may
+		allocate, and any handle already marked free could be handed out and
+		linked again before the batch is unlinked.
 		*/
-		T* currentElement = (T*)handle.location;
-		for (UInt32 i = 0; i < handle.elementCount; ++i)
+		for (ArraySize i = 0; i < handleCount; ++i)
 		{
-			currentElement->~T();
-			++currentElement;
+			if (handles[i].m_IsValid)
+			{
+				DestructElements<T>(handles[i].m_Handle);
+			}
 		}
 
-		DeleteHandle(&handle);
+		/*
+		Mark each handle so they can all be unlinked in one pass.
+		*/
+		ArraySize markedHandles = 0;
+		for (ArraySize i = 0; i < handleCount; ++i)
+		{
+			if (!handles[i].m_IsValid)
+			{
+				continue;
+			}
+
+			Handle* handle = handles[i].Detach();
+
+			// Large and purged blocks aren't in the arena's list.
+			if (handle->isLargeBlock || !handle->location)
+			{
+				DeleteHandle(handle);
+				continue;
+			}
+
+			handle->isUsed = false;
+			++markedHandles;
+		}
+
+		DeleteMarkedHandles(markedHandles);
+	}
+
+	template <class T>
+	void MemoryManager::DestructElements(Handle* handle)
+	{
+		/*
+		Trivially destructible types have nothing to clean up.
+		*/
+		if constexpr (!std::is_trivially_destructible<T>::value)
+		{
+			T* currentElement = (T*)handle->location;
+			for (UInt32 i = 0; i < handle->elementCount; ++i)
+			{
+				currentElement->~T();
+				++currentElement;
+			}
+		}
 	}
 
 	template <class T>
 	Handle* MemoryManager::SetupNewHandle(ArraySize count)
 	{
+		if (count * sizeof(T) >= m_LargeAllocationThreshold)
+		{
+			return SetupLargeHandle(count * sizeof(T), count);
+		}
+
 		// TODO: Move FindFirstFreeMemoryBlock call onto a separate thread.
+		return SetupNewHandles<T>(1, &count);
+	}
+
+	template <class T>
+	Handle* MemoryManager::SetupNewHandles(ArraySize batchSize,
+		const ArraySize* counts)
+	{
 		/*
-		Find the first available memory slot that can accomodate this memory
-		block.
+		Find a single memory slot that can accomodate every block.
 		*/
+		ByteCount totalSize = 0;
+		for (ArraySize i = 0; i < batchSize; ++i)
+		{
+			totalSize += counts[i] * sizeof(T);
+		}
+
 		Handle* previousHandle = nullptr;
-		void* availableBlock =
-			FindFirstFreeMemoryBlock(count * sizeof(T), &previousHandle);
+		Byte* availableBlock =
+			(Byte*)FindFirstFreeMemoryBlock(totalSize, &previousHandle);
 
 		/*
-		Find the first available Handle.
+		Claim and chain the free Handles, continuing each search from the last
+		one found.
 		*/
+		Handle* firstHandle = nullptr;
+		Handle* lastHandle = nullptr;
 		Handle* currentHandle = m_HandleTableStart;
-		while (currentHandle->isUsed)
+		for (ArraySize i = 0; i < batchSize; ++i)
 		{
-			++currentHandle;
+			currentHandle = FindFreeHandle(currentHandle);
+
+			currentHandle->location = availableBlock;
+			currentHandle->byteSize = counts[i] * sizeof(T);
+			currentHandle->elementCount = counts[i];
+			currentHandle->isUsed = true;
+			currentHandle->isCopyable = true;
+			currentHandle->isLargeBlock = false;
+			currentHandle->isPurgeable = false;
+			currentHandle->sampleSite = 0;
+			availableBlock += currentHandle->byteSize;
+
+			if (HeapProfiler::IsSampling())
+			{
+				HeapProfiler::RecordAllocation(currentHandle);
+			}
+
+			if (lastHandle)
+			{
+				lastHandle->nextHandle = currentHandle;
+			}
+			else
+			{
+				firstHandle = currentHandle;
+			}
+			lastHandle = currentHandle;
 		}
 
+		LinkHandles(previousHandle, firstHandle, lastHandle);
+
 		/*
-		Allocate memory and configure handles. We only need to construct the
-		object if we are not allocating for an array. If we're not allocating
-		an array, just set the memory to 0.
+		Keep track of usage so the next run can be sized from it.
 		*/
-		memset(availableBlock, 0, count * sizeof(T));
-		if (previousHandle)
+		m_ArenaAllocatedBytes += totalSize;
+		m_HandleCount += (HandleTableSize)batchSize;
+		if (m_ArenaAllocatedBytes > m_PeakArenaBytes)
 		{
-			currentHandle->nextHandle = previousHandle->nextHandle;
-			previousHandle->nextHandle = currentHandle;
+			m_PeakArenaBytes = m_ArenaAllocatedBytes;
 		}
-		else
+		if (m_HandleCount > m_PeakHandleCount)
 		{
-			// This is the first handle of the table
-			m_FirstHandle = currentHandle;
+			m_PeakHandleCount = m_HandleCount;
 		}
-		currentHandle->location = availableBlock;
-		currentHandle->byteSize = count * sizeof(T);
-		currentHandle->elementCount = count;
-		currentHandle->isUsed = true;
-		currentHandle->isCopyable = true;
 
-		return currentHandle;
+		return firstHandle;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,332 @@
+/*
+The interface between the MemoryManager and the objects that are allocated
+within it. SharedHandles can be created from UniqueHandles and copied to share
+ownership of memory.
+@file SharedHandle.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	This is to be used similarly to std::shared_ptr<T>. The reference count is
+	stored in the Handle itself, so sharing memory takes no extra allocations
+	and the memory can still be defragmented.
+
+	The reference count is only updated atomically if IsAtomic is true, which
+	is needed when copies of the same SharedHandle are made or destroyed on
+	different threads.
+	*/
+	template <class T, bool IsAtomic = false>
+	class SharedHandle
+	{
+	public:
+		SharedHandle();
+		SharedHandle(UniqueHandle<T>&& uniqueHandle);
+		SharedHandle(const SharedHandle& otherHandle);
+		SharedHandle(SharedHandle&& otherHandle);
+
+		~SharedHandle();
+
+		SharedHandle& operator=(const SharedHandle& otherHandle);
+		SharedHandle& operator=(SharedHandle&& otherHandle);
+
+		T* operator->();
+		T& operator*();
+		T& operator[](ArraySize index);
+		const T* operator->() const;
+		const T& operator*() const;
+		const T& operator[](ArraySize index) const;
+
+		bool operator==(const SharedHandle& other) const;
+		bool operator!=(const SharedHandle& other) const;
+
+		/*
+		Returns whether this SharedHandle is active and usable.
+
+		@return Boolean containing the validity of this SharedHandle.
+		*/
+		bool IsValid() const;
+
+		/*
+		Returns the number of SharedHandles that share this memory.
+
+		@return UInt32 containing the number of owners of this memory.
+		*/
+		UInt32 GetReferenceCount() const;
+
+		/*
+		Gives up this SharedHandle's ownership of the memory, deallocating it if
+		this was the last owner, and makes this SharedHandle invalid.
+		*/
+		void Release();
+
+		/*
+		USE CAUTIOUSLY!!! Gets the memory at pointed to by this handle.
+
+		@return Pointer to the memory managed by this handle.
+		*/
+		T* GetMemory();
+
+		/*
+		USE CAUTIOUSLY!!! Gets the memory at pointed to by this handle.
+
+		@return Pointer to the memory managed by this handle.
+		*/
+		const T* GetMemory() const;
+
+		/*
+		Makes the data this SharedHandle points to unable to be defragmented
+		by the MemoryManager.
+
+		@param isImmovable - Whether the data is immovable or not.
+		*/
+		void SetImmovable(bool isImmovable);
+
+		/*
+		Returns whether the data at the underlying handle can not be moved
+		trivially.
+
+		@return True if the underlying data can not be moved trivially.
+		*/
+		const bool IsImmovable() const;
+
+	private:
+		/*
+		Adds an owner to the underlying handle.
+		*/
+		void AddReference();
+
+		/*
+		Removes an owner from the underlying handle, deallocating the memory if
+		there are no owners left.
+		*/
+		void RemoveReference();
+
+	private:
+		Handle* m_Handle; // Pointer to this SharedHandle's Handle.
+	};
+
+	template <class T, bool IsAtomic>
+	SharedHandle<T, IsAtomic>::SharedHandle() :
+		m_Handle(nullptr)
+	{
+
+	}
+
+	template <class T, bool IsAtomic>
+	SharedHandle<T, IsAtomic>::SharedHandle(UniqueHandle<T>&& uniqueHandle) :
+		m_Handle(uniqueHandle.Detach())
+	{
+		if (m_Handle)
+		{
+			m_Handle->referenceCount.store(1, std::memory_order_relaxed);
+		}
+	}
+
+	template <class T, bool IsAtomic>
+	SharedHandle<T, IsAtomic>::SharedHandle(const SharedHandle& otherHandle) :
+		m_Handle(otherHandle.m_Handle)
+	{
+		AddReference();
+	}
+
+	template <class T, bool IsAtomic>
+	SharedHandle<T, IsAtomic>::SharedHandle(SharedHandle&& otherHandle) :
+		m_Handle(otherHandle.m_Handle)
+	{
+		otherHandle.m_Handle = nullptr;
+	}
+
+	template <class T, bool IsAtomic>
+	SharedHandle<T, IsAtomic>::~SharedHandle()
+	{
+		RemoveReference();
+	}
+
+	template <class T, bool IsAtomic>
+	SharedHandle<T, IsAtomic>& SharedHandle<T, IsAtomic>::operator=(
+		const SharedHandle& otherHandle)
+	{
+		if (m_Handle != otherHandle.m_Handle)
+		{
+			RemoveReference();
+			m_Handle = otherHandle.m_Handle;
+			AddReference();
+		}
+
+		return *this;
+	}
+
+	template <class T, bool IsAtomic>
+	SharedHandle<T, IsAtomic>& SharedHandle<T, IsAtomic>::operator=(
+		SharedHandle&& otherHandle)
+	{
+		if (this != &otherHandle)
+		{
+			RemoveReference();
+			m_Handle = otherHandle.m_Handle;
+			otherHandle.m_Handle = nullptr;
+		}
+
+		return *this;
+	}
+
+	template <class T, bool IsAtomic>
+	T* SharedHandle<T, IsAtomic>::operator->()
+	{
+		return (T*)m_Handle->location;
+	}
+
+	template <class T, bool IsAtomic>
+	T& SharedHandle<T, IsAtomic>::operator*()
+	{
+		return *((T*)(m_Handle->location));
+	}
+
+	template <class T, bool IsAtomic>
+	T& SharedHandle<T, IsAtomic>::operator[](ArraySize index)
+	{
+		return ((T*)m_Handle->location)[index];
+	}
+
+	template <class T, bool IsAtomic>
+	const T* SharedHandle<T, IsAtomic>::operator->() const
+	{
+		return (T*)m_Handle->location;
+	}
+
+	template <class T, bool IsAtomic>
+	const T& SharedHandle<T, IsAtomic>::operator*() const
+	{
+		return *((T*)(m_Handle->location));
+	}
+
+	template <class T, bool IsAtomic>
+	const T& SharedHandle<T, IsAtomic>::operator[](ArraySize index) const
+	{
+		return ((T*)m_Handle->location)[index];
+	}
+
+	template <class T, bool IsAtomic>
+	bool SharedHandle<T, IsAtomic>::operator==(const SharedHandle& other) const
+	{
+		return m_Handle == other.m_Handle;
+	}
+
+	template <class T, bool IsAtomic>
+	bool SharedHandle<T, IsAtomic>::operator!=(const SharedHandle& other) const
+	{
+		return m_Handle != other.m_Handle;
+	}
+
+	template <class T, bool IsAtomic>
+	bool SharedHandle<T, IsAtomic>::IsValid() const
+	{
+		return m_Handle != nullptr;
+	}
+
+	template <class T, bool IsAtomic>
+	UInt32 SharedHandle<T, IsAtomic>::GetReferenceCount() const
+	{
+		return m_Handle ? m_Handle->referenceCount.load(std::memory_order_relaxed) : 0;
+	}
+
+	template <class T, bool IsAtomic>
+	void SharedHandle<T, IsAtomic>::Release()
+	{
+		Assert(m_Handle);
+
+		RemoveReference();
+		m_Handle = nullptr;
+	}
+
+	template <class T, bool IsAtomic>
+	T* SharedHandle<T, IsAtomic>::GetMemory()
+	{
+		return (T*)m_Handle->location;
+	}
+
+	template <class T, bool IsAtomic>
+	const T* SharedHandle<T, IsAtomic>::GetMemory() const
+	{
+		return (const T*)m_Handle->location;
+	}
+
+	template <class T, bool IsAtomic>
+	void SharedHandle<T, IsAtomic>::SetImmovable(bool isImmovable)
+	{
+		Assert(m_Handle);
+
+		m_Handle->isCopyable = !isImmovable;
+	}
+
+	template <class T, bool IsAtomic>
+	const bool SharedHandle<T, IsAtomic>::IsImmovable() const
+	{
+		Assert(m_Handle);
+
+		return !m_Handle->isCopyable;
+	}
+
+	template <class T, bool IsAtomic>
+	void SharedHandle<T, IsAtomic>::AddReference()
+	{
+		if (!m_Handle)
+		{
+			return;
+		}
+
+		if constexpr (IsAtomic)
+		{
+			m_Handle->referenceCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			UInt32 referenceCount =
+				m_Handle->referenceCount.load(std::memory_order_relaxed);
+			m_Handle->referenceCount.store(referenceCount + 1,
+				std::memory_order_relaxed);
+		}
+	}
+
+	template <class T, bool IsAtomic>
+	void SharedHandle<T, IsAtomic>::RemoveReference()
+	{
+		if (!m_Handle)
+		{
+			return;
+		}
+
+		/*
+		The last owner deallocates the memory.
+		*/
+		UInt32 referenceCount;
+		if constexpr (IsAtomic)
+		{
+			referenceCount =
+				m_Handle->referenceCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		}
+		else
+		{
+			referenceCount =
+				m_Handle->referenceCount.load(std::memory_order_relaxed) - 1;
+			m_Handle->referenceCount.store(referenceCount, std::memory_order_relaxed);
+		}
+
+		if (referenceCount == 0)
+		{
+			MemoryManager::Deallocate<T>(*m_Handle);
+		}
+	}
+
+	template <class T, bool IsAtomic>
+	struct IsTriviallyRelocatable<SharedHandle<T, IsAtomic>> : std::true_type {};
+}
\ No newline at end of file
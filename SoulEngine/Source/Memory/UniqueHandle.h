@@ -4,12 +4,13 @@ within it. The MemoryManager returns UniqueHandles which can then be used like
 normal pointers to memory.
 @file UniqueHandle.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #pragma once
 
 #include <Memory/MemoryManager.h>
+#include <UtilsLib/TypeTraits.h>
 
 namespace Soul
 {
@@ -42,7 +43,8 @@ namespace Soul
 		bool operator!=(const UniqueHandle& other) const;
 
 		/*
-		Returns whether this UniqueHandle is active and usable.
+		Returns whether this UniqueHandle is active and usable. Purgeable
+		memory stops being usable once it has been purged.
 
 		@return Boolean containing the validity of this UniqueHandle.
 		*/
@@ -76,6 +78,12 @@ namespace Soul
 		*/
 		const T* GetMemory() const;
 
+		/*
+		Marks the memory under this handle as recently used, so purgeable
+		memory is among the last to be evicted.
+		*/
+		void Touch();
+
 		/*
 		Makes the data this UniquePointer points to unable to be defragmented
 		by the MemoryManager.
@@ -100,6 +108,7 @@ namespace Soul
 		bool m_IsValid; // Whether this UniqueHandle is active and usable.
 
 		friend WeakHandle;
+		friend MemoryManager;
 	};
 
 	template <class T>
@@ -203,7 +212,7 @@ namespace Soul
 	template <class T>
 	bool UniqueHandle<T>::IsValid() const
 	{
-		return m_IsValid;
+		return m_IsValid && m_Handle->location;
 	}
 
 	template <class T>
@@ -238,6 +247,14 @@ namespace Soul
 		return (const T*)m_Handle->location;
 	}
 
+	template <class T>
+	void UniqueHandle<T>::Touch()
+	{
+		Assert(m_IsValid);
+
+		MemoryManager::Touch(m_Handle);
+	}
+
 	template <class T>
 	void UniqueHandle<T>::SetImmovable(bool isImmovable)
 	{
@@ -253,4 +270,7 @@ namespace Soul
 
 		return !m_Handle->isCopyable;
 	}
+
+	template <class T>
+	struct IsTriviallyRelocatable<UniqueHandle<T>> : std::true_type {};
 }
\ No newline at end of file
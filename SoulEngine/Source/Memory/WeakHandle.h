@@ -4,13 +4,14 @@ within it. The MemoryManager returns UniqueHandles which can then be used to
 form weak pointers to memory.
 @file WeakHandle.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #pragma once
 
 #include <Memory/MemoryManager.h>
 #include <Memory/UniqueHandle.h>
+#include <UtilsLib/TypeTraits.h>
 
 namespace Soul
 {
@@ -229,4 +230,7 @@ namespace Soul
 
 		return !m_Handle->isCopyable;
 	}
+
+	template <class T>
+	struct IsTriviallyRelocatable<WeakHandle<T>> : std::true_type {};
 }
\ No newline at end of file
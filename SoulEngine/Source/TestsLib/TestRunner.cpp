@@ -3,22 +3,41 @@ Used for aggregating and running tests. Assumes that all necessary engine
 systems are currently running.
 @file TestRunner.cpp
 @author Jacob Peterson
-@edited 4/25/21
+@edited 10/19/26
 */
 
 #include "TestRunner.h"
 
 #include <TestsLib/TestMacros.h>
+#include <TestsLib/Tests/BitArrayTests.h>
+#include <TestsLib/Tests/BucketArrayTests.h>
+#include <TestsLib/Tests/DelegateTests.h>
+#include <TestsLib/Tests/EventStagingRingTests.h>
+#include <TestsLib/Tests/EventStreamTests.h>
 #include <TestsLib/Tests/EventTests.h>
+#include <TestsLib/Tests/FlatMapTests.h>
+#include <TestsLib/Tests/FlatSetTests.h>
+#include <TestsLib/Tests/FrameStringTests.h>
+#include <TestsLib/Tests/FrameVectorTests.h>
+#include <TestsLib/Tests/HashMapTests.h>
 #include <TestsLib/Tests/MathTests/FunctionTests.h>
 #include <TestsLib/Tests/MathTests/Vector3DTests.h>
 #include <TestsLib/Tests/MemoryManagerTests.h>
+#include <TestsLib/Tests/PriorityQueueTests.h>
+#include <TestsLib/Tests/SharedHandleTests.h>
+#include <TestsLib/Tests/SlotMapTests.h>
+#include <TestsLib/Tests/SmallVectorTests.h>
+#include <TestsLib/Tests/SoAVectorTests.h>
+#include <TestsLib/Tests/SortTests.h>
+#include <TestsLib/Tests/ThreadSafeQueueTests.h>
 #include <TestsLib/Tests/UniqueHandleTests.h>
 #include <TestsLib/Tests/QueueTests.h>
 #include <TestsLib/Tests/StringTests.h>
 #include <TestsLib/Tests/TextFileTests.h>
+#include <TestsLib/Tests/UsageProfileTests.h>
 #include <TestsLib/Tests/VectorTests.h>
 #include <TestsLib/Tests/WeakHandleTests.h>
+#include <TestsLib/Tests/WorkerPoolTests.h>
 
 namespace Soul
 {
@@ -37,6 +56,25 @@ namespace Soul
 		CreateTestSuite(TextFileTests);
 		CreateTestSuite(FunctionTests);
 		CreateTestSuite(Vector3DTests);
+		CreateTestSuite(UsageProfileTests);
+		CreateTestSuite(SharedHandleTests);
+		CreateTestSuite(FrameVectorTests);
+		CreateTestSuite(FrameStringTests);
+		CreateTestSuite(SmallVectorTests);
+		CreateTestSuite(ThreadSafeQueueTests);
+		CreateTestSuite(HashMapTests);
+		CreateTestSuite(SlotMapTests);
+		CreateTestSuite(BucketArrayTests);
+		CreateTestSuite(SortTests);
+		CreateTestSuite(SoAVectorTests);
+		CreateTestSuite(FlatMapTests);
+		CreateTestSuite(FlatSetTests);
+		CreateTestSuite(PriorityQueueTests);
+		CreateTestSuite(BitArrayTests);
+		CreateTestSuite(DelegateTests);
+		CreateTestSuite(EventStreamTests);
+		CreateTestSuite(EventStagingRingTests);
+		CreateTestSuite(WorkerPoolTests);
 	}
 
 	void TestRunner::RunTestSuite(ITestSuite* testSuite)
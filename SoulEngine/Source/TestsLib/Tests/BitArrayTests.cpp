@@ -0,0 +1,225 @@
+/*
+Tests for the BitArray class.
+@file BitArrayTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "BitArrayTests.h"
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/BitArray.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	void BitArrayTests::RunAllTests()
+	{
+		RunTest(SetAndTest);
+		RunTest(CountAndFind);
+		RunTest(BulkOperations);
+		RunTest(ResizeArray);
+		RunTest(BulkBenchmark);
+	}
+
+	bool BitArrayTests::SetAndTest()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			BitArray bits(200);
+
+			for (ArraySize i = 0; i < 200; ++i)
+			{
+				AssertFalse(bits.Test(i), "New bits were not clear.");
+			}
+
+			bits.Set(0);
+			bits.Set(63);
+			bits.Set(64);
+			bits.Set(199);
+			bits.Assign(100, true);
+			bits.Assign(63, false);
+
+			AssertTrue(bits.Test(0), "Failed to set first bit.");
+			AssertFalse(bits.Test(63), "Failed to assign bit.");
+			AssertTrue(bits.Test(64), "Failed to set bit across a word boundary.");
+			AssertTrue(bits.Test(100), "Failed to assign bit.");
+			AssertTrue(bits.Test(199), "Failed to set last bit.");
+
+			bits.Clear(64);
+			AssertFalse(bits.Test(64), "Failed to clear bit.");
+
+			bits.SetAll();
+			AssertEqual(bits.Count(), 200, "SetAll set bits past the end.");
+
+			bits.ClearAll();
+			AssertEqual(bits.Count(), 0, "Failed to clear every bit.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate BitArray.");
+
+		return true;
+	}
+
+	bool BitArrayTests::CountAndFind()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			BitArray bits(1000);
+
+			for (ArraySize i = 3; i < 1000; i += 7)
+			{
+				bits.Set(i);
+			}
+
+			AssertEqual(bits.Count(), 143, "Incorrect set bit count.");
+			AssertEqual(bits.FindFirstSet(), 3, "Incorrect first set bit.");
+			AssertEqual(bits.FindFirstSet(4), 10, "Incorrect next set bit.");
+			AssertEqual(bits.FindFirstSet(997), 997, "Start bit was skipped.");
+			AssertEqual(bits.FindFirstSet(998), 1000, "Found bit past the last set bit.");
+
+			ArraySize expected = 3;
+			bool ordered = true;
+			bits.ForEachSetBit([&](ArraySize index) {
+				ordered = ordered && index == expected;
+				expected += 7;
+			});
+
+			AssertTrue(ordered, "ForEachSetBit visited the wrong bits.");
+			AssertEqual(expected, 1000 + 4, "ForEachSetBit missed bits.");
+
+			BitArray empty;
+			AssertEqual(empty.Count(), 0, "Empty BitArray has set bits.");
+			AssertEqual(empty.FindFirstSet(), 0, "Found bit in empty BitArray.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate BitArray.");
+
+		return true;
+	}
+
+	bool BitArrayTests::BulkOperations()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			// An odd word count exercises both the SIMD and scalar paths
+			BitArray visible(300);
+			BitArray occluded(300);
+
+			for (ArraySize i = 0; i < 300; i += 2)
+			{
+				visible.Set(i);
+			}
+			for (ArraySize i = 0; i < 300; i += 3)
+			{
+				occluded.Set(i);
+			}
+
+			BitArray both(300);
+			both.Or(visible);
+			both.And(occluded);
+			AssertEqual(both.Count(), 50, "Incorrect And result.");
+
+			BitArray either(300);
+			either.Or(visible);
+			either.Or(occluded);
+			AssertEqual(either.Count(), 200, "Incorrect Or result.");
+
+			visible.AndNot(occluded);
+			AssertEqual(visible.Count(), 100, "Incorrect AndNot result.");
+			AssertTrue(visible.Test(298), "AndNot cleared a visible bit.");
+			AssertFalse(visible.Test(294), "AndNot kept an occluded bit.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate BitArrays.");
+
+		return true;
+	}
+
+	bool BitArrayTests::ResizeArray()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			BitArray bits(10);
+			bits.SetAll();
+
+			bits.Resize(500);
+			AssertEqual(bits.Count(), 10, "Grown bits were not clear.");
+			bits.Set(499);
+
+			bits.Resize(5);
+			AssertEqual(bits.Count(), 5, "Shrinking kept dropped bits.");
+
+			bits.Resize(500);
+			AssertEqual(bits.Count(), 5, "Dropped bits came back after growing.");
+
+			BitArray moved(std::move(bits));
+			AssertEqual(moved.Length(), 500, "Failed to move BitArray.");
+			AssertEqual(bits.Length(), 0, "Moved-from BitArray not empty.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate resized BitArray.");
+
+		return true;
+	}
+
+	bool BitArrayTests::BulkBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			constexpr UInt32 bitCount = 1 << 20;
+			Timer timer;
+
+			Vector<bool> byteFlags(bitCount);
+			Vector<bool> otherByteFlags(bitCount);
+			BitArray bits(bitCount);
+			BitArray otherBits(bitCount);
+
+			for (UInt32 i = 0; i < bitCount; ++i)
+			{
+				byteFlags.Push(i % 3 == 0);
+				otherByteFlags.Push(i % 5 == 0);
+				bits.Assign(i, i % 3 == 0);
+				otherBits.Assign(i, i % 5 == 0);
+			}
+
+			UInt32 byteCount = 0;
+			timer.Start();
+			for (UInt32 i = 0; i < bitCount; ++i)
+			{
+				byteFlags[i] = byteFlags[i] && otherByteFlags[i];
+				byteCount += byteFlags[i];
+			}
+			timer.Stop();
+			SoulLogInfo("Vector<bool> And and count over %u flags: %f ms", bitCount,
+				timer.GetElapsedMilliseconds());
+
+			timer.Reset();
+			timer.Start();
+			bits.And(otherBits);
+			ArraySize bitArrayCount = bits.Count();
+			timer.Stop();
+			SoulLogInfo("BitArray And and Count over %u bits: %f ms", bitCount,
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(bitArrayCount, byteCount, "Mismatched And results.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark flags.");
+
+		return true;
+	}
+}
\ No newline at end of file
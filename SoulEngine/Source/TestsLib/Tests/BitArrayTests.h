@@ -0,0 +1,29 @@
+/*
+Tests for the BitArray class.
+@file BitArrayTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the BitArray class.
+	*/
+	class BitArrayTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool SetAndTest();
+		bool CountAndFind();
+		bool BulkOperations();
+		bool ResizeArray();
+		bool BulkBenchmark();
+	};
+}
\ No newline at end of file
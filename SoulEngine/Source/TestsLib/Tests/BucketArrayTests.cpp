@@ -0,0 +1,229 @@
+/*
+Tests for the BucketArray class.
+@file BucketArrayTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "BucketArrayTests.h"
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestClass.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/BucketArray.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	void BucketArrayTests::RunAllTests()
+	{
+		RunTest(PushAndIndex);
+		RunTest(StableAddresses);
+		RunTest(ChunkIteration);
+		RunTest(ObjectElements);
+		RunTest(GrowthBenchmark);
+	}
+
+	bool BucketArrayTests::PushAndIndex()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			BucketArray<UInt32, 8> intArray;
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				intArray.Push(i);
+			}
+
+			AssertEqual(intArray.Length(), 100, "Incorrect BucketArray length.");
+			AssertEqual(intArray.Capacity(), 104, "Incorrect BucketArray capacity.");
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				AssertEqual(intArray[i], i, "Incorrect element across chunks.");
+			}
+
+			AssertEqual(intArray.Pop(), 99, "Incorrect popped element.");
+			AssertEqual(intArray.Length(), 99, "Failed to pop element.");
+
+			intArray.Reserve(200);
+			AssertTrue(intArray.Capacity() >= 200, "Failed to reserve chunks.");
+			AssertEqual(intArray[98], 98, "Reserve changed the elements.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate primitive BucketArray.");
+
+		return true;
+	}
+
+	bool BucketArrayTests::StableAddresses()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			BucketArray<TestClass, 4> classArray;
+			TestClass fakeClass = { 1, 'a', 1.5f };
+
+			TestClass* first = &classArray.Push(fakeClass);
+			TestClass* fifth = nullptr;
+
+			for (UInt32 i = 1; i < 64; ++i)
+			{
+				TestClass& added = classArray.Push(fakeClass);
+				if (i == 4)
+				{
+					fifth = &added;
+				}
+			}
+
+			// Free up some space in front of the chunks and give them a reason to move
+			{
+				Vector<UInt32> filler(64);
+			}
+			MemoryManager::Defragment(8);
+
+			AssertTrue(first == &classArray[0], "First element moved during growth.");
+			AssertTrue(fifth == &classArray[4], "Element moved during growth.");
+			AssertEqual(*first, fakeClass, "Stable element was overwritten.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate object BucketArray.");
+
+		return true;
+	}
+
+	bool BucketArrayTests::ChunkIteration()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			BucketArray<UInt32, 16> intArray;
+
+			for (UInt32 i = 0; i < 40; ++i)
+			{
+				intArray.Push(i);
+			}
+
+			UInt32 chunks = 0;
+			UInt32 sum = 0;
+			UInt32 expected = 0;
+			bool ordered = true;
+
+			intArray.ForEachChunk([&](UInt32* elements, ArraySize count) {
+				++chunks;
+				for (ArraySize i = 0; i < count; ++i)
+				{
+					ordered = ordered && elements[i] == expected++;
+					sum += elements[i];
+				}
+			});
+
+			AssertEqual(chunks, 3, "Incorrect number of chunks iterated.");
+			AssertTrue(ordered, "Chunks iterated out of order.");
+			AssertEqual(sum, 39 * 40 / 2, "Chunk iteration missed elements.");
+
+			intArray.Clear();
+			chunks = 0;
+			intArray.ForEachChunk([&](UInt32* elements, ArraySize count) {
+				++chunks;
+			});
+
+			AssertEqual(chunks, 0, "Iterated chunks of a cleared BucketArray.");
+			AssertEqual(intArray.Capacity(), 48, "Clear released chunks.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate BucketArray.");
+
+		return true;
+	}
+
+	bool BucketArrayTests::ObjectElements()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			BucketArray<String, 4> stringArray;
+
+			for (UInt32 i = 0; i < 10; ++i)
+			{
+				stringArray.EmplaceBack("Bucket");
+			}
+
+			String popped = stringArray.Pop();
+			AssertTrue(popped == "Bucket", "Incorrect popped String.");
+
+			stringArray.Push(String("Last"));
+			AssertTrue(stringArray[9] == "Last", "Failed to reuse popped slot.");
+
+			BucketArray<String, 4> movedArray(std::move(stringArray));
+			AssertEqual(movedArray.Length(), 10, "Failed to move BucketArray.");
+			AssertEqual(stringArray.Length(), 0, "Moved-from BucketArray not empty.");
+
+			movedArray.Clear();
+			movedArray.Push(String("Again"));
+			AssertTrue(movedArray[0] == "Again", "Failed to push after clearing.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate String BucketArray.");
+
+		return true;
+	}
+
+	bool BucketArrayTests::GrowthBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Timer timer;
+
+			Vector<UInt32> intVector(1);
+			timer.Start();
+			for (UInt32 i = 0; i < 100000; ++i)
+			{
+				intVector.Push(i);
+			}
+			timer.Stop();
+			SoulLogInfo("Vector<UInt32> 100000 Push: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			BucketArray<UInt32, 1024> intArray;
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < 100000; ++i)
+			{
+				intArray.Push(i);
+			}
+			timer.Stop();
+			SoulLogInfo("BucketArray<UInt32> 100000 Push: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			UInt64 sum = 0;
+			timer.Reset();
+			timer.Start();
+			intArray.ForEachChunk([&sum](UInt32* elements, ArraySize count) {
+				for (ArraySize i = 0; i < count; ++i)
+				{
+					sum += elements[i];
+				}
+			});
+			timer.Stop();
+			SoulLogInfo("BucketArray<UInt32> 100000 chunk iteration: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(sum, 99999ULL * 100000ULL / 2, "Incorrect BucketArray sum.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark containers.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+Tests for the BucketArray class.
+@file BucketArrayTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the BucketArray class.
+	*/
+	class BucketArrayTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PushAndIndex();
+		bool StableAddresses();
+		bool ChunkIteration();
+		bool ObjectElements();
+		bool GrowthBenchmark();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+/*
+Tests for the Delegate class.
+@file DelegateTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "DelegateTests.h"
+
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Delegate.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	static UInt32 AddOne(UInt32 x)
+	{
+		return x + 1;
+	}
+
+	struct DelegateCounter
+	{
+		UInt64 total;
+
+		void Add(void* data)
+		{
+			total += *(UInt32*)data;
+		}
+
+		UInt32 Scale(UInt32 x)
+		{
+			return x * (UInt32)total;
+		}
+	};
+
+	static_assert(std::is_trivially_copyable<Delegate<void(void*)>>::value,
+		"Delegates must stay trivially copyable.");
+
+	void DelegateTests::RunAllTests()
+	{
+		RunTest(FunctionPointer);
+		RunTest(CapturingLambda);
+		RunTest(BoundMethod);
+		RunTest(ZeroedDelegate);
+		RunTest(DispatchBenchmark);
+	}
+
+	bool DelegateTests::FunctionPointer()
+	{
+		Delegate<UInt32(UInt32)> delegate(&AddOne);
+
+		AssertTrue(delegate.IsValid(), "Function pointer Delegate is not valid.");
+		AssertEqual(delegate(41), 42, "Incorrect function pointer result.");
+
+		Delegate<UInt32(UInt32)> copy = delegate;
+		AssertEqual(copy(1), 2, "Copied Delegate lost its function.");
+
+		return true;
+	}
+
+	bool DelegateTests::CapturingLambda()
+	{
+		UInt32 calls = 0;
+		UInt32 offset = 7;
+
+		Delegate<UInt32(UInt32)> delegate = [&calls, offset](UInt32 x) {
+			++calls;
+			return x + offset;
+		};
+
+		AssertEqual(delegate(3), 10, "Incorrect capturing lambda result.");
+		AssertEqual(delegate(5), 12, "Incorrect capturing lambda result.");
+		AssertEqual(calls, 2, "Lambda did not write through its capture.");
+
+		// Delegates are memcpy-safe, so they can live in relocating containers
+		Vector<Delegate<UInt32(UInt32)>> delegates(1);
+		for (UInt32 i = 0; i < 10; ++i)
+		{
+			delegates.Push([i](UInt32 x) { return x * i; });
+		}
+
+		AssertEqual(delegates[9](2), 18, "Delegate broken by Vector growth.");
+
+		return true;
+	}
+
+	bool DelegateTests::BoundMethod()
+	{
+		DelegateCounter counter = { 3 };
+
+		auto scale = Delegate<UInt32(UInt32)>::Bind<&DelegateCounter::Scale>(&counter);
+		AssertEqual(scale(5), 15, "Incorrect bound method result.");
+
+		auto add = Delegate<void(void*)>::Bind<&DelegateCounter::Add>(&counter);
+		UInt32 value = 4;
+		add(&value);
+		AssertEqual(counter.total, 7, "Bound method did not modify its object.");
+
+		return true;
+	}
+
+	bool DelegateTests::ZeroedDelegate()
+	{
+		Delegate<void(void*)> empty;
+		AssertFalse(empty.IsValid(), "Default Delegate is valid.");
+
+		Byte zeroed[sizeof(Delegate<void(void*)>)];
+		memset(zeroed, 0, sizeof(zeroed));
+		AssertFalse(((Delegate<void(void*)>*)zeroed)->IsValid(),
+			"Zeroed Delegate is valid.");
+
+		return true;
+	}
+
+	bool DelegateTests::DispatchBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			constexpr UInt32 callbackCount = 64;
+			constexpr UInt32 dispatchCount = 20000;
+			Timer timer;
+			UInt64 total = 0;
+			UInt32 value = 1;
+
+			Delegate<void(void*)> delegates[callbackCount];
+			std::function<void(void*)> functions[callbackCount];
+			for (UInt32 i = 0; i < callbackCount; ++i)
+			{
+				delegates[i] = [&total, i](void* data) { total += *(UInt32*)data + i; };
+				functions[i] = [&total, i](void* data) { total += *(UInt32*)data + i; };
+			}
+
+			timer.Start();
+			for (UInt32 j = 0; j < dispatchCount; ++j)
+			{
+				for (UInt32 i = 0; i < callbackCount; ++i)
+				{
+					functions[i](&value);
+				}
+			}
+			timer.Stop();
+			SoulLogInfo("std::function %u calls: %f ms", callbackCount * dispatchCount,
+				timer.GetElapsedMilliseconds());
+
+			UInt64 functionTotal = total;
+			total = 0;
+			timer.Reset();
+			timer.Start();
+			for (UInt32 j = 0; j < dispatchCount; ++j)
+			{
+				for (UInt32 i = 0; i < callbackCount; ++i)
+				{
+					delegates[i](&value);
+				}
+			}
+			timer.Stop();
+			SoulLogInfo("Delegate %u calls: %f ms", callbackCount * dispatchCount,
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(total, functionTotal, "Mismatched Delegate and std::function calls.");
+
+			/*
+			A capture of three pointers is past std::function's small buffer on
+			most standard libraries, so every construction allocates.
+			*/
+			UInt64 a = 1, b = 2, c = 3;
+			UInt64 constructed = 0;
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < dispatchCount; ++i)
+			{
+				std::function<void(void*)> function = [&a, &b, &c](void*) { a += b + c; };
+				function(nullptr);
+				++constructed;
+			}
+			timer.Stop();
+			SoulLogInfo("std::function %u constructions: %f ms", dispatchCount,
+				timer.GetElapsedMilliseconds());
+
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < dispatchCount; ++i)
+			{
+				Delegate<void(void*)> delegate = [&a, &b, &c](void*) { a += b + c; };
+				delegate(nullptr);
+				++constructed;
+			}
+			timer.Stop();
+			SoulLogInfo("Delegate %u constructions: %f ms", dispatchCount,
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(a, 1 + 5ULL * constructed, "Constructed callbacks were not called.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark Delegates.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+Tests for the Delegate class.
+@file DelegateTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the Delegate class.
+	*/
+	class DelegateTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool FunctionPointer();
+		bool CapturingLambda();
+		bool BoundMethod();
+		bool ZeroedDelegate();
+		bool DispatchBenchmark();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*
+Tests for the EventStagingRing class.
+@file EventStagingRingTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "EventStagingRingTests.h"
+
+#include <thread>
+
+#include <Events/EventStagingRing.h>
+#include <Events/EventStream.h>
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+
+namespace Soul
+{
+	void EventStagingRingTests::RunAllTests()
+	{
+		RunTest(PushAndDrain);
+		RunTest(FullRing);
+		RunTest(ConcurrentDrain);
+	}
+
+	bool EventStagingRingTests::PushAndDrain()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			EventStagingRing ring;
+			EventStream stream(64);
+			Events eventType;
+			void* data;
+
+			AssertEqual(ring.DrainInto(stream), 0, "Drained an empty ring.");
+
+			UInt64 number = 42;
+			int pointee = 7;
+			AssertTrue(ring.TryPush(Events::EventTest, &number, sizeof(number)),
+				"Failed to push.");
+			AssertTrue(ring.TryPushPointer(Events::EventTest, &pointee),
+				"Failed to push pointer.");
+			AssertTrue(ring.TryPush(Events::EventTest, nullptr, 0),
+				"Failed to push empty payload.");
+
+			AssertEqual(ring.DrainInto(stream), 3, "Incorrect number of events drained.");
+			AssertEqual(stream.GetLength(), 3, "Events weren't moved to the stream.");
+
+			stream.Peek(eventType, data);
+			AssertEqual(*(UInt64*)data, 42, "Incorrect inline payload.");
+			stream.Pop();
+			stream.Peek(eventType, data);
+			AssertTrue(data == &pointee, "Pointer event wasn't passed through.");
+			stream.Pop();
+			AssertTrue(stream.Peek(eventType, data), "Lost empty payload event.");
+			stream.Pop();
+		}
+
+		AssertEqual(MemoryManager::GetTotalAllocatedBytes(), initialBytes,
+			"Ring leaked memory.");
+
+		return true;
+	}
+
+	bool EventStagingRingTests::FullRing()
+	{
+		EventStagingRing ring;
+		EventStream stream(64);
+		Events eventType;
+		void* data;
+
+		// 24 byte payloads make 32 byte records, which fill the ring exactly.
+		UInt8 payload[24] = {};
+		UInt32 pushed = 0;
+		while (ring.TryPush(Events::EventTest, payload, sizeof(payload)))
+		{
+			++pushed;
+		}
+		AssertEqual(pushed, EventStagingRing::Capacity / 32,
+			"Ring held the wrong number of records.");
+
+		AssertEqual(ring.DrainInto(stream), pushed, "Lost events from a full ring.");
+		while (stream.Peek(eventType, data))
+		{
+			stream.Pop();
+		}
+
+		// Odd sizes leave gaps at the end of the ring that must be skipped.
+		const UInt32 eventCount = 10000;
+		UInt32 expected = 0;
+		for (UInt32 i = 0; i < eventCount; ++i)
+		{
+			payload[0] = (UInt8)i;
+			if (!ring.TryPush(Events::EventTest, payload, 1 + i % 24))
+			{
+				ring.DrainInto(stream);
+				while (stream.Peek(eventType, data))
+				{
+					AssertEqual(*(UInt8*)data, (UInt8)expected, "Events came out of order.");
+					++expected;
+					stream.Pop();
+				}
+				AssertTrue(ring.TryPush(Events::EventTest, payload, 1 + i % 24),
+					"Failed to push after draining.");
+			}
+		}
+
+		ring.DrainInto(stream);
+		while (stream.Peek(eventType, data))
+		{
+			AssertEqual(*(UInt8*)data, (UInt8)expected, "Events came out of order.");
+			++expected;
+			stream.Pop();
+		}
+		AssertEqual(expected, eventCount, "Lost events.");
+
+		return true;
+	}
+
+	bool EventStagingRingTests::ConcurrentDrain()
+	{
+		const UInt64 eventCount = 100000;
+		EventStagingRing ring;
+		EventStream stream(64);
+		Events eventType;
+		void* data;
+
+		std::thread producer([&ring, eventCount]() {
+			for (UInt64 i = 0; i < eventCount;)
+			{
+				if (ring.TryPush(Events::EventTest, &i, sizeof(i)))
+				{
+					++i;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		UInt64 expected = 0;
+		bool inOrder = true;
+		while (expected < eventCount)
+		{
+			if (ring.DrainInto(stream) == 0)
+			{
+				std::this_thread::yield();
+			}
+
+			while (stream.Peek(eventType, data))
+			{
+				inOrder = inOrder && *(UInt64*)data == expected;
+				++expected;
+				stream.Pop();
+			}
+		}
+		producer.join();
+
+		AssertTrue(inOrder, "Events came out of order.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+/*
+Tests for the EventStagingRing class.
+@file EventStagingRingTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the EventStagingRing class.
+	*/
+	class EventStagingRingTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PushAndDrain();
+		bool FullRing();
+		bool ConcurrentDrain();
+	};
+}
\ No newline at end of file
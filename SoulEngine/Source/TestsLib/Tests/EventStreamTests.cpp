@@ -0,0 +1,162 @@
+/*
+Tests for the EventStream class.
+@file EventStreamTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "EventStreamTests.h"
+
+#include <Events/EventStream.h>
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+
+namespace Soul
+{
+	void EventStreamTests::RunAllTests()
+	{
+		RunTest(PushAndPop);
+		RunTest(WrapAround);
+		RunTest(GrowWhilePeeking);
+	}
+
+	bool EventStreamTests::PushAndPop()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			EventStream stream(64);
+			Events eventType;
+			void* data;
+
+			AssertFalse(stream.Peek(eventType, data), "Peeked an empty stream.");
+
+			UInt32 number = 42;
+			UInt8 bytes[3] = { 1, 2, 3 };
+			int pointee = 7;
+			stream.Push(Events::EventTest, &number, sizeof(number));
+			stream.Push(Events::EventTest, bytes, sizeof(bytes));
+			stream.PushPointer(Events::EventTest, &pointee);
+			stream.Push(Events::EventTest, nullptr, 0);
+
+			AssertEqual(stream.GetLength(), 4, "Incorrect number of events.");
+
+			AssertTrue(stream.Peek(eventType, data), "Failed to peek event.");
+			AssertTrue(eventType == Events::EventTest, "Incorrect event type.");
+			AssertEqual(*(UInt32*)data, 42, "Incorrect inline payload.");
+			number = 0;
+			AssertEqual(*(UInt32*)data, 42, "Payload wasn't copied.");
+			stream.Pop();
+
+			stream.Peek(eventType, data);
+			AssertEqual(((UInt8*)data)[2], 3, "Incorrect odd-sized payload.");
+			AssertEqual((PtrSize)data % 8, 0, "Payload is misaligned.");
+			stream.Pop();
+
+			stream.Peek(eventType, data);
+			AssertTrue(data == &pointee, "Pointer event wasn't passed through.");
+			stream.Pop();
+
+			AssertTrue(stream.Peek(eventType, data), "Lost empty payload event.");
+			stream.Pop();
+
+			AssertEqual(stream.GetLength(), 0, "Stream wasn't emptied.");
+			AssertFalse(stream.Peek(eventType, data), "Peeked an empty stream.");
+		}
+
+		AssertEqual(MemoryManager::GetTotalAllocatedBytes(), initialBytes,
+			"Stream leaked memory.");
+
+		return true;
+	}
+
+	bool EventStreamTests::WrapAround()
+	{
+		EventStream stream(64);
+		Events eventType;
+		void* data;
+
+		// Each record takes 16 bytes, so keeping 3 queued wraps around often.
+		UInt64 next = 0;
+		UInt64 expected = 0;
+		for (UInt64 i = 0; i < 3; ++i)
+		{
+			stream.Push(Events::EventTest, &next, sizeof(next));
+			++next;
+		}
+		for (UInt64 i = 0; i < 100; ++i)
+		{
+			stream.Push(Events::EventTest, &next, sizeof(next));
+			++next;
+
+			AssertTrue(stream.Peek(eventType, data), "Lost an event.");
+			AssertEqual(*(UInt64*)data, expected, "Events came out of order.");
+			++expected;
+			stream.Pop();
+		}
+
+		AssertEqual(stream.GetCapacity(), 64, "Stream grew without needing to.");
+
+		// Odd sizes leave gaps at the end of the buffer that must be skipped.
+		while (stream.Peek(eventType, data))
+		{
+			stream.Pop();
+		}
+
+		UInt8 payload[20] = {};
+		for (UInt32 i = 0; i < 200; ++i)
+		{
+			payload[0] = (UInt8)i;
+			stream.Push(Events::EventTest, payload, 1 + i % 20);
+
+			if (i >= 2)
+			{
+				AssertTrue(stream.Peek(eventType, data), "Lost an event.");
+				AssertEqual(*(UInt8*)data, (UInt8)(i - 2),
+					"Events came out of order after wrapping.");
+				stream.Pop();
+			}
+		}
+
+		AssertEqual(stream.GetLength(), 2, "Incorrect number of events.");
+
+		return true;
+	}
+
+	bool EventStreamTests::GrowWhilePeeking()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			EventStream stream(64);
+			Events eventType;
+			void* data;
+
+			UInt64 value = 0;
+			stream.Push(Events::EventTest, &value, sizeof(value));
+			stream.Peek(eventType, data);
+
+			// Grow twice while the first payload is still in use.
+			for (value = 1; value < 40; ++value)
+			{
+				stream.Push(Events::EventTest, &value, sizeof(value));
+			}
+
+			AssertTrue(stream.GetCapacity() >= 40 * 16, "Stream didn't grow.");
+			AssertEqual(*(UInt64*)data, 0, "Peeked payload didn't stay valid.");
+			stream.Pop();
+
+			for (UInt64 i = 1; i < 40; ++i)
+			{
+				AssertTrue(stream.Peek(eventType, data), "Lost an event.");
+				AssertEqual(*(UInt64*)data, i, "Events came out of order.");
+				stream.Pop();
+			}
+		}
+
+		AssertEqual(MemoryManager::GetTotalAllocatedBytes(), initialBytes,
+			"Stream leaked memory.");
+
+		return true;
+	}
+}
\ No newline at end of file
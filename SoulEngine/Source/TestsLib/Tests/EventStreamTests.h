@@ -0,0 +1,27 @@
+/*
+Tests for the EventStream class.
+@file EventStreamTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the EventStream class.
+	*/
+	class EventStreamTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PushAndPop();
+		bool WrapAround();
+		bool GrowWhilePeeking();
+	};
+}
\ No newline at end of file
@@ -2,16 +2,20 @@
 Tests for the EventBus and EventListener classes.
 @file EventTests.h
 @author Jacob Peterson
-@edited 4/15/21
+@edited 10/19/26
 */
 
 #include "EventTests.h"
 
+#include <chrono>
+#include <thread>
+
 #include <TestsLib/TestMacros.h>
 #include <TestsLib/TestClass.h>
 #include <Events/EventBus.h>
 #include <Events/EventListener.h>
 #include <UtilsLib/Logger.h>
+#include <UtilsLib/Timer.h>
 
 namespace Soul
 {
@@ -21,6 +25,12 @@ namespace Soul
 		RunTest(ObjectDataEvent);
 		RunTest(ExpandedCallbackVector);
 		RunTest(SeveralEvents);
+		RunTest(InlinePayloadEvent);
+		RunTest(QueueDuringDispatch);
+		RunTest(MultipleProducers);
+		RunTest(ProducerBenchmark);
+		RunTest(ParallelDispatch);
+		RunTest(ParallelDispatchBenchmark);
 	}
 
 	bool EventTests::PrimitiveDataEvent()
@@ -48,7 +58,7 @@ namespace Soul
 
 		TestClass fakeClass = { 1, 'a', 3.5f };
 
-		EventCallback callback = [fakeClass](void* data) {
+		EventCallback callback = [&fakeClass](void* data) {
 			TestClass* objectPointer = (TestClass*)data;
 			Assert(*objectPointer == fakeClass);
 		};
@@ -65,14 +75,8 @@ namespace Soul
 
 	bool EventTests::ExpandedCallbackVector()
 	{
-		UniqueHandle<Vector<Callback>> registeredCallbacks =
-			MemoryManager::AllocateArray<Vector<Callback>>((ArraySize)Events::EventTotal);
-
-		for (ArraySize i = 0; i < (ArraySize)Events::EventTotal; ++i)
-		{
-			Vector<Callback> vec(4);
-			registeredCallbacks[i] = std::move(vec);
-		}
+		UniqueHandle<CallbackList> registeredCallbacks =
+			MemoryManager::AllocateArray<CallbackList>((ArraySize)Events::EventTotal);
 
 		Callback callback1{ [](void* data) { }, 0 };
 		Callback callback2{ [](void* data) { }, 1 };
@@ -90,6 +94,11 @@ namespace Soul
 		registeredCallbacks[0].Push(callback6);
 		registeredCallbacks[0].Push(callback7);
 
+		AssertFalse(registeredCallbacks[0].IsInline(),
+			"Callback list didn't spill out of its inline storage.");
+		AssertEqual(registeredCallbacks[0].Length(), 7,
+			"Incorrect number of callbacks.");
+
 		return true;
 	}
 
@@ -148,4 +157,321 @@ namespace Soul
 
 		return true;
 	}
+
+	bool EventTests::InlinePayloadEvent()
+	{
+		struct Payload
+		{
+			UInt32 x;
+			UInt8 y;
+			Float32 z;
+		};
+
+		EventListener eventListener;
+
+		UInt32 callCount = 0;
+		EventCallback callback = [&callCount](void* data) {
+			Payload* payload = (Payload*)data;
+			Assert(payload->x == callCount && payload->y == 'b' && payload->z == 1.5f);
+			++callCount;
+		};
+		eventListener.RegisterCallback(Events::EventTest, callback);
+
+		// The payloads are copied, so they can go out of scope before dispatch.
+		for (UInt32 i = 0; i < 3; ++i)
+		{
+			Payload payload = { i, 'b', 1.5f };
+			eventListener.QueueEvent(Events::EventTest, payload);
+		}
+
+		EventBus::DispatchEvents();
+
+		AssertEqual(callCount, 3, "Incorrect number of events dispatched.");
+
+		return true;
+	}
+
+	bool EventTests::QueueDuringDispatch()
+	{
+		EventListener eventListener;
+
+		UInt64 expected = 0;
+		bool inOrder = true;
+		EventCallback callback = [&expected, &inOrder](void* data) {
+			UInt64 value = *(UInt64*)data;
+			inOrder = inOrder && value == expected;
+			++expected;
+
+			// Queue enough follow-up events to make the stream grow while
+			// this payload is still being read.
+			if (value == 0)
+			{
+				for (UInt64 i = 1; i < 1000; ++i)
+				{
+					EventBus::QueueEvent(Events::EventTest, i);
+				}
+			}
+			inOrder = inOrder && *(UInt64*)data == value;
+		};
+		eventListener.RegisterCallback(Events::EventTest, callback);
+
+		eventListener.QueueEvent(Events::EventTest, (UInt64)0);
+
+		EventBus::DispatchEvents();
+
+		AssertTrue(inOrder, "Events were dispatched out of order.");
+		AssertEqual(expected, 1000, "Events queued during dispatch were lost.");
+
+		return true;
+	}
+
+	bool EventTests::MultipleProducers()
+	{
+		struct Payload
+		{
+			UInt32 producer;
+			UInt32 sequence;
+		};
+
+		const UInt32 producerCount = 3;
+		const UInt32 eventsPerProducer = 100;
+		const UInt32 mainThread = producerCount;
+
+		EventListener eventListener;
+
+		Payload expected = { mainThread, 0 };
+		bool inOrder = true;
+		EventCallback callback = [&expected, &inOrder](void* data) {
+			Payload* payload = (Payload*)data;
+			inOrder = inOrder && payload->producer == expected.producer &&
+				payload->sequence == expected.sequence;
+
+			// The dispatching thread's events come first, then producer 0's...
+			++expected.sequence;
+			if (expected.producer == mainThread && expected.sequence == 10)
+			{
+				expected = { 0, 0 };
+			}
+			else if (expected.sequence == 100)
+			{
+				expected = { expected.producer + 1, 0 };
+			}
+		};
+		eventListener.RegisterCallback(Events::EventTest, callback);
+
+		// Start the producers in reverse so arrival order doesn't match.
+		std::thread producers[producerCount];
+		for (UInt32 t = 0; t < producerCount; ++t)
+		{
+			UInt32 producerIndex = producerCount - 1 - t;
+			producers[t] = std::thread([producerIndex, eventsPerProducer]() {
+				EventBus::RegisterProducerThread(producerIndex);
+				for (UInt32 i = 0; i < eventsPerProducer; ++i)
+				{
+					EventBus::QueueEvent(Events::EventTest, Payload{ producerIndex, i });
+				}
+				EventBus::UnregisterProducerThread();
+			});
+		}
+
+		for (UInt32 i = 0; i < 10; ++i)
+		{
+			eventListener.QueueEvent(Events::EventTest, Payload{ mainThread, i });
+		}
+
+		for (UInt32 t = 0; t < producerCount; ++t)
+		{
+			producers[t].join();
+		}
+
+		EventBus::DispatchEvents();
+
+		AssertTrue(inOrder, "Events were dispatched out of order.");
+		AssertEqual(expected.producer, producerCount, "Lost staged events.");
+
+		return true;
+	}
+
+	bool EventTests::ProducerBenchmark()
+	{
+		const UInt64 eventsPerProducer = 200000;
+		EventListener eventListener;
+
+		UInt64 received = 0;
+		EventCallback callback = [&received](void* data) {
+			++received;
+		};
+		eventListener.RegisterCallback(Events::EventTest, callback);
+
+		Timer timer;
+		for (UInt32 producerCount = 1; producerCount <= 4; ++producerCount)
+		{
+			std::thread producers[4];
+			received = 0;
+
+			timer.Reset();
+			timer.Start();
+			for (UInt32 t = 0; t < producerCount; ++t)
+			{
+				producers[t] = std::thread([t, eventsPerProducer]() {
+					EventBus::RegisterProducerThread(t);
+					for (UInt64 i = 0; i < eventsPerProducer; ++i)
+					{
+						EventBus::QueueEvent(Events::EventTest, i);
+					}
+					EventBus::UnregisterProducerThread();
+				});
+			}
+
+			/*
+			Keep dispatching like a frame loop until every event arrives. Sleep
+			rather than yield when nothing has arrived so the producers get the
+			core on machines with fewer cores than threads.
+			*/
+			while (received < eventsPerProducer * producerCount)
+			{
+				UInt64 previous = received;
+				EventBus::DispatchEvents();
+				if (received == previous)
+				{
+					std::this_thread::sleep_for(std::chrono::microseconds(100));
+				}
+			}
+			timer.Stop();
+
+			for (UInt32 t = 0; t < producerCount; ++t)
+			{
+				producers[t].join();
+			}
+
+			SoulLogInfo("EventBus %u producers: %f events/ms", producerCount,
+				(eventsPerProducer * producerCount) / timer.GetElapsedMilliseconds());
+		}
+
+		return true;
+	}
+
+	bool EventTests::ParallelDispatch()
+	{
+		struct ListenerState
+		{
+			UInt64 expected; // The next sequence number this listener should see.
+			bool inOrder; // Whether every event arrived in order.
+		};
+
+		const UInt32 listenerCount = 3;
+		EventListener eventListener;
+		ListenerState states[listenerCount] = {};
+
+		for (UInt32 i = 0; i < listenerCount; ++i)
+		{
+			states[i].inOrder = true;
+			ListenerState* state = states + i;
+			EventCallback callback = [state](void* data) {
+				state->inOrder = state->inOrder && *(UInt64*)data == state->expected;
+				++state->expected;
+			};
+			eventListener.RegisterCallback(Events::EventTest, callback, true);
+		}
+
+		/*
+		The serial callback runs after the thread-safe ones have finished the
+		whole batch, and its follow-up event is dispatched as the next batch.
+		*/
+		std::thread::id mainThread = std::this_thread::get_id();
+		UInt64 serialCount = 0;
+		bool serialInOrder = true;
+		ListenerState* firstState = states;
+		EventCallback serialCallback =
+			[&serialCount, &serialInOrder, firstState](void* data) {
+			UInt64 value = *(UInt64*)data;
+			serialInOrder = serialInOrder && value == serialCount &&
+				firstState->expected == (value < 100 ? 100 : 101);
+			++serialCount;
+			if (value == 99)
+			{
+				EventBus::QueueEvent(Events::EventTest, (UInt64)100);
+			}
+		};
+		eventListener.RegisterCallback(Events::EventTest, serialCallback);
+
+		EventBus::EnableParallelDispatch(2);
+
+		for (UInt64 i = 0; i < 100; ++i)
+		{
+			eventListener.QueueEvent(Events::EventTest, i);
+		}
+		EventBus::DispatchEvents();
+
+		EventBus::DisableParallelDispatch();
+
+		for (UInt32 i = 0; i < listenerCount; ++i)
+		{
+			AssertTrue(states[i].inOrder, "Thread-safe callback saw events out of order.");
+			AssertEqual(states[i].expected, 101, "Thread-safe callback missed events.");
+		}
+		AssertTrue(serialInOrder, "Serial callback ran out of order.");
+		AssertEqual(serialCount, 101, "Serial callback missed events.");
+		AssertTrue(std::this_thread::get_id() == mainThread, "Dispatch changed threads.");
+
+		return true;
+	}
+
+	bool EventTests::ParallelDispatchBenchmark()
+	{
+		const UInt32 listenerCount = 4;
+		const UInt64 eventCount = 2000;
+		EventListener eventListener;
+		volatile UInt64 results[listenerCount * 8] = {};
+
+		// Each listener does a few microseconds of work per event.
+		for (UInt32 i = 0; i < listenerCount; ++i)
+		{
+			volatile UInt64* result = results + i * 8;
+			EventCallback callback = [result](void* data) {
+				UInt64 value = *(UInt64*)data;
+				for (UInt32 j = 0; j < 2000; ++j)
+				{
+					value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+				}
+				*result += value;
+			};
+			eventListener.RegisterCallback(Events::EventTest, callback, true);
+		}
+
+		Timer timer;
+		UInt32 workerCount = std::thread::hardware_concurrency() - 1;
+		if (workerCount > listenerCount - 1)
+		{
+			workerCount = listenerCount - 1;
+		}
+
+		for (UInt32 parallel = 0; parallel < 2; ++parallel)
+		{
+			if (parallel)
+			{
+				EventBus::EnableParallelDispatch(workerCount);
+			}
+
+			timer.Reset();
+			timer.Start();
+			for (UInt64 i = 0; i < eventCount; ++i)
+			{
+				EventBus::QueueEvent(Events::EventTest, i);
+			}
+			EventBus::DispatchEvents();
+			timer.Stop();
+
+			SoulLogInfo("EventBus %s dispatch, %u listeners, %u workers: %f ms",
+				parallel ? "parallel" : "serial", listenerCount,
+				parallel ? workerCount : 0, timer.GetElapsedMilliseconds());
+
+			if (parallel)
+			{
+				EventBus::DisableParallelDispatch();
+			}
+		}
+
+		return true;
+	}
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 Tests for the EventBus and EventListener classes.
 @file EventTests.h
 @author Jacob Peterson
-@edited 4/15/21
+@edited 10/19/26
 */
 
 #pragma once
@@ -21,5 +21,11 @@ namespace Soul
 		bool ObjectDataEvent();
 		bool ExpandedCallbackVector();
 		bool SeveralEvents();
+		bool InlinePayloadEvent();
+		bool QueueDuringDispatch();
+		bool MultipleProducers();
+		bool ProducerBenchmark();
+		bool ParallelDispatch();
+		bool ParallelDispatchBenchmark();
 	};
 }
\ No newline at end of file
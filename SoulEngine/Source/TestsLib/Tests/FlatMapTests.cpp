@@ -0,0 +1,224 @@
+/*
+Tests for the FlatMap class.
+@file FlatMapTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "FlatMapTests.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <random>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/FlatMap.h>
+#include <UtilsLib/Containers/HashMap.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	struct StringLess
+	{
+		bool operator()(const String& a, const String& b) const
+		{
+			return strcmp(a.GetCString(), b.GetCString()) < 0;
+		}
+	};
+
+	void FlatMapTests::RunAllTests()
+	{
+		RunTest(InsertAndFind);
+		RunTest(BulkBuild);
+		RunTest(StringKeys);
+		RunTest(LookupBenchmark);
+	}
+
+	bool FlatMapTests::InsertAndFind()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			FlatMap<UInt32, UInt32> intMap(4);
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				UInt32 key = (i * 37) % 100;
+				AssertTrue(intMap.Insert(key, key * 2), "Failed to insert key.");
+			}
+
+			AssertFalse(intMap.Insert(5, 0), "Inserted duplicate key.");
+			AssertEqual(intMap.Length(), 100, "Incorrect FlatMap length.");
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				AssertEqual(intMap.GetKey(i), i, "Keys are not sorted.");
+				AssertEqual(*intMap.Find(i), i * 2, "Incorrect value for key.");
+			}
+
+			AssertTrue(intMap.Find(100) == nullptr, "Found key that was never inserted.");
+
+			intMap[200] = 7;
+			++intMap[200];
+			AssertEqual(*intMap.Find(200), 8, "operator[] failed to insert.");
+
+			AssertTrue(intMap.Remove(50), "Failed to remove key.");
+			AssertFalse(intMap.Remove(50), "Removed the same key twice.");
+			AssertFalse(intMap.Contains(50), "Found removed key.");
+			AssertEqual(*intMap.Find(51), 102, "Remove disturbed the next key.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate FlatMap.");
+
+		return true;
+	}
+
+	bool FlatMapTests::BulkBuild()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			FlatMap<Int32, UInt32> intMap;
+
+			for (UInt32 i = 0; i < 1000; ++i)
+			{
+				intMap.AddUnsorted((Int32)((i * 7919) % 500) - 250, i);
+			}
+
+			intMap.Build();
+
+			AssertEqual(intMap.Length(), 500, "Build failed to drop duplicate keys.");
+
+			for (ArraySize i = 1; i < intMap.Length(); ++i)
+			{
+				AssertTrue(intMap.GetKey(i - 1) < intMap.GetKey(i), "Build failed to sort keys.");
+			}
+
+			// Each key was added twice, and the second value should win
+			for (UInt32 i = 500; i < 1000; ++i)
+			{
+				Int32 key = (Int32)((i * 7919) % 500) - 250;
+				AssertEqual(*intMap.Find(key), i, "Build kept the wrong duplicate.");
+			}
+
+			UInt32 visited = 0;
+			intMap.ForEach([&visited](const Int32& key, UInt32& value) {
+				++visited;
+			});
+			AssertEqual(visited, 500, "ForEach missed entries.");
+
+			intMap.Clear();
+			AssertEqual(intMap.Length(), 0, "Failed to clear FlatMap.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate bulk built FlatMap.");
+
+		return true;
+	}
+
+	bool FlatMapTests::StringKeys()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			FlatMap<String, UInt32, StringLess> configMap;
+
+			configMap.AddUnsorted(String("window.width"), 1280);
+			configMap.AddUnsorted(String("audio.volume"), 80);
+			configMap.AddUnsorted(String("window.height"), 720);
+			configMap.Build();
+
+			configMap.Insert(String("input.sensitivity"), 5);
+
+			AssertTrue(configMap.GetKey(0) == "audio.volume", "Incorrect String key order.");
+			AssertTrue(configMap.GetKey(1) == "input.sensitivity", "Incorrect String key order.");
+			AssertEqual(*configMap.Find(String("window.height")), 720,
+				"Incorrect value for String key.");
+			AssertFalse(configMap.Contains(String("window.depth")),
+				"Found String key that was never inserted.");
+
+			FlatMap<String, UInt32, StringLess> movedMap(std::move(configMap));
+			AssertEqual(movedMap.Length(), 4, "Failed to move FlatMap.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate String FlatMap.");
+
+		return true;
+	}
+
+	bool FlatMapTests::LookupBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			constexpr UInt32 keyCount = 1000;
+			constexpr UInt32 lookupCount = 1000000;
+			std::mt19937 random(3);
+			Timer timer;
+
+			FlatMap<UInt32, UInt32> flatMap(keyCount);
+			HashMap<UInt32, UInt32> hashMap(keyCount);
+			std::map<UInt32, UInt32> stdMap;
+
+			for (UInt32 i = 0; i < keyCount; ++i)
+			{
+				flatMap.AddUnsorted(i * 3, i);
+				hashMap.Insert(i * 3, i);
+				stdMap[i * 3] = i;
+			}
+			flatMap.Build();
+
+			UInt64 flatSum = 0;
+			timer.Start();
+			for (UInt32 i = 0; i < lookupCount; ++i)
+			{
+				const UInt32* value = flatMap.Find(random() % (keyCount * 3));
+				flatSum += value ? *value : 0;
+			}
+			timer.Stop();
+			SoulLogInfo("FlatMap %u lookups over %u keys: %f ms", lookupCount, keyCount,
+				timer.GetElapsedMilliseconds());
+
+			random.seed(3);
+			UInt64 hashSum = 0;
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < lookupCount; ++i)
+			{
+				const UInt32* value = hashMap.Find(random() % (keyCount * 3));
+				hashSum += value ? *value : 0;
+			}
+			timer.Stop();
+			SoulLogInfo("HashMap %u lookups over %u keys: %f ms", lookupCount, keyCount,
+				timer.GetElapsedMilliseconds());
+
+			random.seed(3);
+			UInt64 stdSum = 0;
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < lookupCount; ++i)
+			{
+				auto entry = stdMap.find(random() % (keyCount * 3));
+				stdSum += entry != stdMap.end() ? entry->second : 0;
+			}
+			timer.Stop();
+			SoulLogInfo("std::map %u lookups over %u keys: %f ms", lookupCount, keyCount,
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(flatSum, hashSum, "Mismatched FlatMap and HashMap lookups.");
+			AssertEqual(flatSum, stdSum, "Mismatched FlatMap and std::map lookups.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark maps.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+/*
+Tests for the FlatMap class.
+@file FlatMapTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the FlatMap class.
+	*/
+	class FlatMapTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool InsertAndFind();
+		bool BulkBuild();
+		bool StringKeys();
+		bool LookupBenchmark();
+	};
+}
\ No newline at end of file
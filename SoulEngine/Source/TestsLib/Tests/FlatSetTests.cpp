@@ -0,0 +1,83 @@
+/*
+Tests for the FlatSet class.
+@file FlatSetTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "FlatSetTests.h"
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/FlatSet.h>
+
+namespace Soul
+{
+	void FlatSetTests::RunAllTests()
+	{
+		RunTest(InsertAndContains);
+		RunTest(BulkBuild);
+	}
+
+	bool FlatSetTests::InsertAndContains()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			FlatSet<UInt64> intSet(2);
+
+			for (UInt64 i = 0; i < 64; ++i)
+			{
+				AssertTrue(intSet.Insert((i * 13) % 64), "Failed to insert key.");
+			}
+
+			AssertFalse(intSet.Insert(10), "Inserted duplicate key.");
+			AssertEqual(intSet.Length(), 64, "Incorrect FlatSet length.");
+
+			for (UInt64 i = 0; i < 64; ++i)
+			{
+				AssertEqual(intSet[i], i, "Keys are not sorted.");
+				AssertTrue(intSet.Contains(i), "Failed to find key.");
+			}
+
+			AssertTrue(intSet.Remove(0), "Failed to remove first key.");
+			AssertTrue(intSet.Remove(63), "Failed to remove last key.");
+			AssertFalse(intSet.Contains(0), "Found removed key.");
+			AssertFalse(intSet.Contains(63), "Found removed key.");
+			AssertFalse(intSet.Contains(64), "Found key that was never inserted.");
+			AssertEqual(intSet[0], 1, "Remove broke key order.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate FlatSet.");
+
+		return true;
+	}
+
+	bool FlatSetTests::BulkBuild()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			FlatSet<Float32> floatSet;
+
+			for (UInt32 i = 0; i < 300; ++i)
+			{
+				floatSet.AddUnsorted((Float32)(i % 100) - 50.0f);
+			}
+
+			floatSet.Build();
+
+			AssertEqual(floatSet.Length(), 100, "Build failed to drop duplicate keys.");
+			AssertTrue(floatSet[0] == -50.0f, "Incorrect smallest key.");
+			AssertTrue(floatSet[99] == 49.0f, "Incorrect largest key.");
+			AssertTrue(floatSet.Contains(0.0f), "Failed to find key after Build.");
+			AssertFalse(floatSet.Contains(0.5f), "Found key that was never added.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate bulk built FlatSet.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+/*
+Tests for the FlatSet class.
+@file FlatSetTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the FlatSet class.
+	*/
+	class FlatSetTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool InsertAndContains();
+		bool BulkBuild();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/*
+Tests for the FrameString class.
+@file FrameStringTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "FrameStringTests.h"
+
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/FrameString.h>
+
+namespace Soul
+{
+	void FrameStringTests::RunAllTests()
+	{
+		RunTest(BuildString);
+		RunTest(InterleavedStrings);
+		RunTest(FrameLifetime);
+		RunTest(MovedFromString);
+	}
+
+	bool FrameStringTests::BuildString()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		FrameString string("Hello");
+		string += ", ";
+		string += "World";
+		string += '!';
+
+		AssertTrue(string == "Hello, World!", "Failed to append to FrameString.");
+		AssertEqual(string.Length(), 13, "Incorrect FrameString length.");
+		AssertEqual(string[7], 'W', "Incorrect FrameString character.");
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"FrameString allocated persistent memory.");
+
+		return true;
+	}
+
+	bool FrameStringTests::InterleavedStrings()
+	{
+		FrameString first;
+		FrameString second;
+
+		for (UInt32 i = 0; i < 40; ++i)
+		{
+			first += 'a';
+			second += "bc";
+		}
+
+		AssertEqual(first.Length(), 40, "Incorrect FrameString length.");
+		AssertEqual(second.Length(), 80, "Incorrect FrameString length.");
+		AssertEqual(first[39], 'a', "Interleaved FrameString lost data.");
+		AssertEqual(second[79], 'c', "Interleaved FrameString lost data.");
+
+		return true;
+	}
+
+	bool FrameStringTests::FrameLifetime()
+	{
+		FrameString string("Temporary");
+
+		AssertTrue(string.IsValid(), "FrameString invalid during its frame.");
+
+		MemoryManager::IncrementFrameCounter();
+
+		AssertFalse(string.IsValid(), "FrameString valid after its frame.");
+
+		return true;
+	}
+
+	bool FrameStringTests::MovedFromString()
+	{
+		FrameString source("Moved");
+		FrameString destination(std::move(source));
+
+		AssertTrue(destination == "Moved", "Move lost the FrameString's contents.");
+		AssertTrue(source.IsValid(), "Moved from FrameString became invalid.");
+		AssertEqual(source.Length(), 0, "Moved from FrameString isn't empty.");
+		AssertTrue(source == "", "Moved from FrameString isn't empty.");
+
+		source += "Reused";
+		AssertTrue(source == "Reused", "Failed to append to moved from FrameString.");
+
+		FrameString other;
+		other = std::move(source);
+		source += 'x';
+		AssertTrue(source == "x", "Failed to append after move assignment.");
+		AssertTrue(other == "Reused", "Move assignment lost the FrameString's contents.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+/*
+Tests for the FrameString class.
+@file FrameStringTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the FrameString class.
+	*/
+	class FrameStringTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool BuildString();
+		bool InterleavedStrings();
+		bool FrameLifetime();
+		bool MovedFromString();
+	};
+}
\ No newline at end of file
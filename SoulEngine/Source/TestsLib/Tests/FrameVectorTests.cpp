@@ -0,0 +1,105 @@
+/*
+Tests for the FrameVector class.
+@file FrameVectorTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "FrameVectorTests.h"
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestClass.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/FrameVector.h>
+
+namespace Soul
+{
+	void FrameVectorTests::RunAllTests()
+	{
+		RunTest(PrimitiveVector);
+		RunTest(ObjectVector);
+		RunTest(InterleavedVectors);
+		RunTest(FrameLifetime);
+	}
+
+	bool FrameVectorTests::PrimitiveVector()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		FrameVector<UInt32> intVector(4);
+
+		for (UInt32 i = 0; i < 255; ++i)
+		{
+			intVector.Push(i);
+		}
+
+		AssertEqual(intVector.Length(), 255, "Incorrect FrameVector length.");
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"FrameVector allocated persistent memory.");
+
+		for (UInt32 i = 0; i < 255; ++i)
+		{
+			AssertEqual(intVector.Pop(), 254 - i,
+				"Failed to store primitive in FrameVector.");
+		}
+
+		return true;
+	}
+
+	bool FrameVectorTests::ObjectVector()
+	{
+		TestClass fakeClass = { 0, 'a', 1.5f };
+		TestClass fakeClass2 = { 1, 'b', 1.8f };
+
+		FrameVector<TestClass> classVector(1);
+
+		for (UInt8 i = 0; i < 100; ++i)
+		{
+			classVector.Push(i % 2 == 0 ? fakeClass : fakeClass2);
+		}
+
+		for (UInt8 i = 0; i < 100; ++i)
+		{
+			AssertEqual(classVector[i], i % 2 == 0 ? fakeClass : fakeClass2,
+				"Failed to store object in FrameVector.");
+		}
+
+		return true;
+	}
+
+	bool FrameVectorTests::InterleavedVectors()
+	{
+		FrameVector<UInt32> intVector(2);
+		FrameVector<UInt8> byteVector(2);
+
+		// Neither vector can grow in place once the other has allocated
+		// after it, so this exercises the copying path.
+		for (UInt32 i = 0; i < 64; ++i)
+		{
+			intVector.Push(i);
+			byteVector.Push((UInt8)i);
+		}
+
+		for (UInt32 i = 0; i < 64; ++i)
+		{
+			AssertEqual(intVector[i], i, "Interleaved FrameVector lost data.");
+			AssertEqual(byteVector[i], i, "Interleaved FrameVector lost data.");
+		}
+
+		return true;
+	}
+
+	bool FrameVectorTests::FrameLifetime()
+	{
+		FrameVector<UInt32> intVector;
+		intVector.Push(1);
+
+		AssertTrue(intVector.IsValid(), "FrameVector invalid during its frame.");
+
+		MemoryManager::IncrementFrameCounter();
+
+		AssertFalse(intVector.IsValid(), "FrameVector valid after its frame.");
+
+		return true;
+	}
+}
\ No newline at end of file
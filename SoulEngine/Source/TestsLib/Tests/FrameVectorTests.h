@@ -0,0 +1,28 @@
+/*
+Tests for the FrameVector class.
+@file FrameVectorTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the FrameVector class.
+	*/
+	class FrameVectorTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PrimitiveVector();
+		bool ObjectVector();
+		bool InterleavedVectors();
+		bool FrameLifetime();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+/*
+Tests for the HashMap class.
+@file HashMapTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "HashMapTests.h"
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestClass.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/HashMap.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	void HashMapTests::RunAllTests()
+	{
+		RunTest(PrimitiveMap);
+		RunTest(StringKeys);
+		RunTest(ObjectValues);
+		RunTest(RemoveAndReinsert);
+		RunTest(LookupBenchmark);
+	}
+
+	bool HashMapTests::PrimitiveMap()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			HashMap<UInt32, UInt32> intMap;
+
+			for (UInt32 i = 0; i < 1000; ++i)
+			{
+				AssertTrue(intMap.Insert(i, i * 2), "Failed to insert key.");
+			}
+
+			AssertFalse(intMap.Insert(5, 0), "Inserted duplicate key.");
+			AssertEqual(intMap.Length(), 1000, "Incorrect HashMap length.");
+
+			for (UInt32 i = 0; i < 1000; ++i)
+			{
+				UInt32* value = intMap.Find(i);
+				AssertTrue(value != nullptr, "Failed to find key.");
+				AssertEqual(*value, i * 2, "Incorrect value for key.");
+			}
+
+			AssertFalse(intMap.Contains(1000), "Found key that was never inserted.");
+
+			intMap[1000] = 7;
+			++intMap[1000];
+
+			AssertEqual(*intMap.Find(1000), 8, "operator[] failed to insert.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate primitive HashMap.");
+
+		return true;
+	}
+
+	bool HashMapTests::StringKeys()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			HashMap<String, UInt32> stringMap(4);
+			char buffer[32];
+
+			for (UInt32 i = 0; i < 200; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "Data/File%u.txt", i);
+				stringMap.Insert(String(buffer), i);
+			}
+
+			for (UInt32 i = 0; i < 200; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "Data/File%u.txt", i);
+				const UInt32* value = stringMap.Find(String(buffer));
+				AssertTrue(value != nullptr, "Failed to find String key.");
+				AssertEqual(*value, i, "Incorrect value for String key.");
+			}
+
+			AssertFalse(stringMap.Contains(String("Data/Missing.txt")),
+				"Found String key that was never inserted.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate String HashMap.");
+
+		return true;
+	}
+
+	bool HashMapTests::ObjectValues()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			HashMap<UInt64, TestClass> classMap;
+			TestClass fakeClass = { 1, 'a', 1.5f };
+			TestClass fakeClass2 = { 2, 'b', 2.5f };
+
+			for (UInt64 i = 0; i < 100; ++i)
+			{
+				classMap.Insert(i << 32, i % 2 == 0 ? fakeClass : fakeClass2);
+			}
+
+			AssertEqual(*classMap.Find(10ULL << 32), fakeClass,
+				"Incorrect object value.");
+			AssertEqual(*classMap.Find(11ULL << 32), fakeClass2,
+				"Incorrect object value.");
+
+			UInt32 count = 0;
+			classMap.ForEach([&count](const UInt64& key, TestClass& value) {
+				++count;
+			});
+
+			AssertEqual(count, 100, "ForEach missed entries.");
+
+			classMap.Clear();
+
+			AssertEqual(classMap.Length(), 0, "Failed to clear HashMap.");
+			AssertFalse(classMap.Contains(0), "Found key after clearing.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate object HashMap.");
+
+		return true;
+	}
+
+	bool HashMapTests::RemoveAndReinsert()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			HashMap<UInt32, String> stringMap(64);
+
+			/*
+			Churn through many more keys than the table holds so deleted
+			markers pile up and have to be cleaned out.
+			*/
+			for (UInt32 i = 0; i < 5000; ++i)
+			{
+				stringMap.Insert(i, String("value"));
+				if (i >= 20)
+				{
+					AssertTrue(stringMap.Remove(i - 20), "Failed to remove key.");
+				}
+			}
+
+			AssertEqual(stringMap.Length(), 20, "Incorrect length after removals.");
+			AssertEqual(stringMap.Capacity(), 64, "HashMap grew from deleted markers.");
+			AssertFalse(stringMap.Remove(0), "Removed key twice.");
+			AssertTrue(*stringMap.Find(4999) == "value", "Lost value while churning.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate churned HashMap.");
+
+		return true;
+	}
+
+	bool HashMapTests::LookupBenchmark()
+	{
+		const UInt32 keyCount = 100000;
+		Timer timer;
+		UInt64 sum = 0;
+
+		{
+			HashMap<UInt32, UInt32> intMap;
+
+			timer.Start();
+			for (UInt32 i = 0; i < keyCount; ++i)
+			{
+				intMap.Insert(i * 7919, i);
+			}
+			for (UInt32 i = 0; i < keyCount; ++i)
+			{
+				sum += *intMap.Find(i * 7919);
+			}
+			timer.Stop();
+			SoulLogInfo("HashMap<UInt32, UInt32> %u inserts and finds: %f ms",
+				keyCount, timer.GetElapsedMilliseconds());
+		}
+
+		{
+			std::unordered_map<UInt32, UInt32> intMap;
+
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < keyCount; ++i)
+			{
+				intMap.emplace(i * 7919, i);
+			}
+			for (UInt32 i = 0; i < keyCount; ++i)
+			{
+				sum -= intMap.find(i * 7919)->second;
+			}
+			timer.Stop();
+			SoulLogInfo("std::unordered_map<UInt32, UInt32> %u inserts and finds: %f ms",
+				keyCount, timer.GetElapsedMilliseconds());
+		}
+
+		/*
+		String keys, looked up repeatedly like file paths or names would be.
+		*/
+		const UInt32 stringCount = 1000;
+		char buffer[32];
+
+		{
+			HashMap<String, UInt32> stringMap;
+			Vector<String> keys(stringCount);
+			for (UInt32 i = 0; i < stringCount; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "Data/File%u.txt", i);
+				keys.Push(String(buffer));
+			}
+
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < stringCount; ++i)
+			{
+				stringMap.Insert(keys[i], i);
+			}
+			for (UInt32 j = 0; j < 100; ++j)
+			{
+				for (UInt32 i = 0; i < stringCount; ++i)
+				{
+					sum += *stringMap.Find(keys[i]);
+				}
+			}
+			timer.Stop();
+			SoulLogInfo("HashMap<String, UInt32> %u inserts and %u finds: %f ms",
+				stringCount, stringCount * 100, timer.GetElapsedMilliseconds());
+		}
+
+		{
+			std::unordered_map<std::string, UInt32> stringMap;
+			std::string keys[stringCount];
+			for (UInt32 i = 0; i < stringCount; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "Data/File%u.txt", i);
+				keys[i] = buffer;
+			}
+
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < stringCount; ++i)
+			{
+				stringMap.emplace(keys[i], i);
+			}
+			for (UInt32 j = 0; j < 100; ++j)
+			{
+				for (UInt32 i = 0; i < stringCount; ++i)
+				{
+					sum -= stringMap.find(keys[i])->second;
+				}
+			}
+			timer.Stop();
+			SoulLogInfo("std::unordered_map<std::string, UInt32> %u inserts and %u finds: %f ms",
+				stringCount, stringCount * 100, timer.GetElapsedMilliseconds());
+		}
+
+		AssertEqual(sum, 0, "Maps disagreed on stored values.");
+
+		return true;
+	}
+}
\ No newline at end of file
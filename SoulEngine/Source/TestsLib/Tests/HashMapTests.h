@@ -0,0 +1,29 @@
+/*
+Tests for the HashMap class.
+@file HashMapTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the HashMap class.
+	*/
+	class HashMapTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PrimitiveMap();
+		bool StringKeys();
+		bool ObjectValues();
+		bool RemoveAndReinsert();
+		bool LookupBenchmark();
+	};
+}
\ No newline at end of file
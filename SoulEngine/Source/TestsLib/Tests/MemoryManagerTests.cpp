@@ -2,16 +2,22 @@
 Tests for the MemoryManager class.
 @file MemoryManagerTests.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #include "MemoryManagerTests.h"
 
+#include <cstring>
+
+#include <IO/TextFile.h>
+#include <Memory/HeapProfiler.h>
 #include <Memory/MemoryManager.h>
 #include <Memory/UniqueHandle.h>
 #include <TestsLib/TestMacros.h>
 #include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Containers/Vector.h>
 #include <UtilsLib/Logger.h>
+#include <UtilsLib/Timer.h>
 
 namespace Soul
 {
@@ -22,6 +28,11 @@ namespace Soul
 		RunTest(VolatileAllocation);
 		RunTest(ImmovableAllocation);
 		RunTest(MemoryDefragmentation);
+		RunTest(TrivialArrayAllocation);
+		RunTest(BatchAllocation);
+		RunTest(LargeAllocation);
+		RunTest(PurgeableAllocation);
+		RunTest(HeapProfiling);
 	}
 
 	bool MemoryManagerTests::BasicAllocation()
@@ -125,4 +136,280 @@ namespace Soul
 
 		return true;
 	}
+
+	bool MemoryManagerTests::TrivialArrayAllocation()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		/*
+		Trivial arrays skip zeroing and per-element destruction, so time a
+		batch of allocations to keep an eye on the fast path.
+		*/
+		Timer timer;
+		timer.Start();
+		for (UInt32 i = 0; i < 10000; ++i)
+		{
+			UniqueHandle<char> charArray = MemoryManager::AllocateArray<char>(4096);
+			charArray[4095] = 'a';
+			AssertEqual(charArray[4095], 'a', "Failed to write to char array.");
+		}
+		timer.Stop();
+		SoulLogInfo("10000 AllocateArray<char>(4096): %f ms",
+			timer.GetElapsedMilliseconds());
+
+		timer.Reset();
+		timer.Start();
+		for (UInt32 i = 0; i < 10000; ++i)
+		{
+			UniqueHandle<UInt32> intArray = MemoryManager::AllocateArray<UInt32>(1024);
+			intArray[1023] = i;
+			AssertEqual(intArray[1023], i, "Failed to write to UInt32 array.");
+		}
+		timer.Stop();
+		SoulLogInfo("10000 AllocateArray<UInt32>(1024): %f ms",
+			timer.GetElapsedMilliseconds());
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Incorrect deallocation of trivial arrays.");
+
+		return true;
+	}
+
+	bool MemoryManagerTests::BatchAllocation()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+		HandleTableSize initialFragments = MemoryManager::CountFragments();
+
+		{
+			ArraySize counts[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+			UniqueHandle<UInt32> handles[8];
+			MemoryManager::AllocateBatch<UInt32>(8, counts, handles);
+
+			AssertEqual(initialBytes + 36 * sizeof(UInt32),
+				MemoryManager::GetTotalAllocatedBytes(),
+				"Incorrect allocation of batch.");
+
+			for (ArraySize i = 0; i < 7; ++i)
+			{
+				AssertEqual(handles[i].GetMemory() + counts[i],
+					handles[i + 1].GetMemory(), "Batch was not contiguous.");
+			}
+
+			for (ArraySize i = 0; i < 8; ++i)
+			{
+				handles[i][counts[i] - 1] = (UInt32)i;
+			}
+			for (ArraySize i = 0; i < 8; ++i)
+			{
+				AssertEqual(handles[i][counts[i] - 1], i, "Batch blocks overlap.");
+			}
+
+			MemoryManager::DeallocateBatch(handles, 8);
+
+			for (ArraySize i = 0; i < 8; ++i)
+			{
+				AssertFalse(handles[i].IsValid(), "Batch handle still valid.");
+			}
+
+			AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+				"Incorrect deallocation of batch.");
+
+			ArraySize vectorCounts[3] = { 4, 4, 4 };
+			UniqueHandle<UniqueHandle<UInt32>> vectorHandles[3];
+			MemoryManager::AllocateBatch<UniqueHandle<UInt32>>(3, vectorCounts,
+				vectorHandles);
+			vectorHandles[1][2] = MemoryManager::Allocate<UInt32>(7);
+			AssertEqual(*vectorHandles[1][2], 7, "Failed to assign into batch.");
+		}
+
+		// Destructors may allocate while the rest of the batch is being freed.
+		struct AllocatingElement
+		{
+			UniqueHandle<UInt32>* allocationOut;
+
+			~AllocatingElement()
+			{
+				*allocationOut = MemoryManager::Allocate<UInt32>(5);
+			}
+		};
+
+		{
+			UniqueHandle<UInt32> allocations[3];
+			ArraySize counts[3] = { 1, 1, 1 };
+			UniqueHandle<AllocatingElement> handles[3];
+			MemoryManager::AllocateBatch<AllocatingElement>(3, counts, handles);
+			for (ArraySize i = 0; i < 3; ++i)
+			{
+				handles[i][0].allocationOut = &allocations[i];
+			}
+
+			MemoryManager::DeallocateBatch(handles, 3);
+
+			for (ArraySize i = 0; i < 3; ++i)
+			{
+				AssertEqual(*allocations[i], 5, "Destructor allocation was freed.");
+			}
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Incorrect deallocation of object batch.");
+		AssertEqual(initialFragments, MemoryManager::CountFragments(),
+			"Batch deallocation left fragments behind.");
+
+		return true;
+	}
+
+	bool MemoryManagerTests::LargeAllocation()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+		ByteCount initialFreeBytes = MemoryManager::GetTotalFreeBytes();
+		HandleTableSize initialFragments = MemoryManager::CountFragments();
+
+		{
+			UniqueHandle<UInt8> smallArray = MemoryManager::AllocateArray<UInt8>(16);
+			UniqueHandle<Byte> largeArray =
+				MemoryManager::AllocateArray<Byte>(Megabytes(4));
+			UniqueHandle<UInt8> smallArray2 = MemoryManager::AllocateArray<UInt8>(16);
+
+			AssertEqual(initialBytes + Megabytes(4) + 32,
+				MemoryManager::GetTotalAllocatedBytes(),
+				"Incorrect allocation of large block.");
+			AssertEqual(initialFreeBytes - 32, MemoryManager::GetTotalFreeBytes(),
+				"Large block was allocated in the arena.");
+			AssertEqual(smallArray.GetMemory() + 16, smallArray2.GetMemory(),
+				"Large block fragmented the arena.");
+
+			largeArray[0] = 1;
+			largeArray[Megabytes(4) - 1] = 2;
+			AssertEqual(largeArray[Megabytes(4) - 1], 2,
+				"Failed to write to large block.");
+
+			largeArray.Deallocate();
+
+			AssertEqual(initialBytes + 32, MemoryManager::GetTotalAllocatedBytes(),
+				"Incorrect deallocation of large block.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Incorrect deallocation of large allocations.");
+		AssertEqual(initialFragments, MemoryManager::CountFragments(),
+			"Large allocations left fragments behind.");
+
+		return true;
+	}
+
+	bool MemoryManagerTests::PurgeableAllocation()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			PurgeCallback countPurge = [](void* owner) {
+				++*(UInt32*)owner;
+			};
+
+			UInt32 purgeCount = 0;
+			UniqueHandle<UInt32> caches[4];
+			for (UInt8 i = 0; i < 3; ++i)
+			{
+				caches[i] = MemoryManager::AllocatePurgeable<UInt32>(100,
+					countPurge, &purgeCount);
+			}
+
+			MemoryManager::SetPurgeableBudget(300 * sizeof(UInt32));
+			caches[0].Touch();
+
+			// Cache 1 is now the least recently touched.
+			caches[3] = MemoryManager::AllocatePurgeable<UInt32>(100,
+				countPurge, &purgeCount);
+
+			AssertTrue(caches[0].IsValid(), "Purged recently touched memory.");
+			AssertFalse(caches[1].IsValid(), "Failed to purge oldest memory.");
+			AssertTrue(caches[2].IsValid(), "Purged too much memory.");
+			AssertTrue(caches[3].IsValid(), "Failed to allocate purgeable memory.");
+			AssertEqual(purgeCount, 1, "Purge callback not called.");
+			AssertEqual(initialBytes + 300 * sizeof(UInt32),
+				MemoryManager::GetTotalAllocatedBytes(),
+				"Purgeable memory over budget.");
+
+			MemoryManager::SetPurgeableBudget(100 * sizeof(UInt32));
+
+			AssertFalse(caches[2].IsValid(), "Failed to purge when shrinking budget.");
+			AssertTrue(caches[3].IsValid(), "Purged newest memory.");
+
+			// Purged handles are still released as usual.
+			caches[1].Deallocate();
+			MemoryManager::DeallocateBatch(caches + 2, 2);
+
+			MemoryManager::SetPurgeableBudget((ByteCount)-1);
+		}
+
+		/*
+		Purging must still find handles that were moved after allocation,
+		here by a Vector growing.
+		*/
+		{
+			Vector<UniqueHandle<UInt32>> caches(1);
+			for (UInt8 i = 0; i < 8; ++i)
+			{
+				caches.Push(MemoryManager::AllocatePurgeable<UInt32>(100, nullptr, nullptr));
+			}
+
+			MemoryManager::SetPurgeableBudget(400 * sizeof(UInt32));
+
+			for (UInt8 i = 0; i < 8; ++i)
+			{
+				AssertEqual(caches[i].IsValid(), i >= 4, "Purged the wrong moved handle.");
+			}
+
+			MemoryManager::SetPurgeableBudget((ByteCount)-1);
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Incorrect deallocation of purgeable memory.");
+
+		return true;
+	}
+
+	bool MemoryManagerTests::HeapProfiling()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			HeapProfiler::SetSampleRate(1);
+
+			UniqueHandle<UInt32> intArray = MemoryManager::AllocateArray<UInt32>(100);
+			UniqueHandle<UInt8> byteArray = MemoryManager::AllocateArray<UInt8>(10);
+
+			AssertEqual(HeapProfiler::GetSampledLiveBytes(), 410,
+				"Failed to sample allocations.");
+
+			HeapProfiler::WriteProfile(
+				"C:/Programming/SoulEngine/SoulEngine/Data/HeapProfile.txt");
+
+			intArray.Deallocate();
+
+			AssertEqual(HeapProfiler::GetSampledLiveBytes(), 10,
+				"Failed to release sampled allocation.");
+
+			HeapProfiler::SetSampleRate(0);
+			byteArray.Deallocate();
+
+			AssertEqual(HeapProfiler::GetSampledLiveBytes(), 0,
+				"Failed to release sample after disabling sampling.");
+
+			TextFile profile("C:/Programming/SoulEngine/SoulEngine/Data/HeapProfile.txt");
+			AssertEqual(profile.GetString().Substring(0, 13), "heap profile:",
+				"Incorrect heap profile header.");
+			AssertTrue(strstr(profile.GetString().GetCString(), "] @ 0x") != nullptr,
+				"Heap profile frames aren't hexadecimal addresses.");
+			AssertTrue(strstr(profile.GetString().GetCString(), "\nMAPPED_LIBRARIES:\n") != nullptr,
+				"Heap profile is missing its module map.");
+			profile.DeleteTextFile();
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Incorrect deallocation of sampled memory.");
+
+		return true;
+	}
 }
\ No newline at end of file
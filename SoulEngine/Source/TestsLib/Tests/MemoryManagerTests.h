@@ -2,7 +2,7 @@
 Tests for the MemoryManager class.
 @file MemoryManagerTests.h
 @author Jacob Peterson
-@edited 4/18/2020
+@edited 10/19/26
 */
 
 #pragma once
@@ -25,5 +25,10 @@ namespace Soul
 		bool VolatileAllocation();
 		bool ImmovableAllocation();
 		bool MemoryDefragmentation();
+		bool TrivialArrayAllocation();
+		bool BatchAllocation();
+		bool LargeAllocation();
+		bool PurgeableAllocation();
+		bool HeapProfiling();
 	};
 }
\ No newline at end of file
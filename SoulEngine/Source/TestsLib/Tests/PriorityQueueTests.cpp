@@ -0,0 +1,266 @@
+/*
+Tests for the PriorityQueue class.
+@file PriorityQueueTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "PriorityQueueTests.h"
+
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/PriorityQueue.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	struct LongerString
+	{
+		bool operator()(const String& a, const String& b) const
+		{
+			return a.Length() > b.Length();
+		}
+	};
+
+	/*
+	Pushes and pops the same random elements through a PriorityQueue of the
+	given arity and logs how long it took.
+	*/
+	template <ArraySize Arity>
+	UInt64 BenchmarkArity(const std::vector<UInt32>& elements)
+	{
+		Timer timer;
+		PriorityQueue<UInt32, Less, Arity> queue((ArraySize)elements.size());
+		UInt64 checksum = 0;
+
+		timer.Start();
+		for (UInt32 element : elements)
+		{
+			queue.Push(element);
+		}
+		while (queue.Length() > 0)
+		{
+			checksum = checksum * 31 + queue.Pop();
+		}
+		timer.Stop();
+		SoulLogInfo("PriorityQueue %u-ary %u Push and Pop: %f ms", (UInt32)Arity,
+			(UInt32)elements.size(), timer.GetElapsedMilliseconds());
+
+		return checksum;
+	}
+
+	void PriorityQueueTests::RunAllTests()
+	{
+		RunTest(PushAndPop);
+		RunTest(UpdateAndRemove);
+		RunTest(HeapifyQueue);
+		RunTest(ObjectQueue);
+		RunTest(ArityBenchmark);
+	}
+
+	bool PriorityQueueTests::PushAndPop()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			PriorityQueue<UInt32> intQueue(2);
+
+			for (UInt32 i = 0; i < 200; ++i)
+			{
+				intQueue.Push((i * 73) % 200);
+			}
+
+			AssertEqual(intQueue.Length(), 200, "Incorrect PriorityQueue length.");
+			AssertEqual(intQueue.Peek(), 0, "Incorrect front element.");
+
+			for (UInt32 i = 0; i < 200; ++i)
+			{
+				AssertEqual(intQueue.Pop(), i, "Elements popped out of order.");
+			}
+
+			AssertEqual(intQueue.Length(), 0, "Failed to pop every element.");
+
+			PriorityQueue<Int32, Less, 2> binaryQueue;
+			Int32 values[] = { 5, -3, 8, 0, -3, 12 };
+			for (Int32 value : values)
+			{
+				binaryQueue.Push(value);
+			}
+
+			AssertEqual(binaryQueue.Pop(), -3, "Incorrect binary heap order.");
+			AssertEqual(binaryQueue.Pop(), -3, "Incorrect binary heap order.");
+			AssertEqual(binaryQueue.Pop(), 0, "Incorrect binary heap order.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate PriorityQueue.");
+
+		return true;
+	}
+
+	bool PriorityQueueTests::UpdateAndRemove()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			PriorityQueue<UInt32> timerQueue;
+			Vector<SlotKey> keys(32);
+
+			for (UInt32 i = 0; i < 32; ++i)
+			{
+				keys.Push(timerQueue.Push(100 + i));
+			}
+
+			// Decrease-key moves an element to the front
+			AssertTrue(timerQueue.Update(keys[20], 1), "Failed to update element.");
+			AssertEqual(timerQueue.Peek(), 1, "Decreased element not at the front.");
+			AssertEqual(*timerQueue.Find(keys[20]), 1, "Key lost its element.");
+
+			// Increasing the key moves it back
+			AssertTrue(timerQueue.Update(keys[20], 500), "Failed to update element.");
+			AssertEqual(timerQueue.Peek(), 100, "Increased element stayed at the front.");
+
+			AssertTrue(timerQueue.Remove(keys[0]), "Failed to remove element.");
+			AssertFalse(timerQueue.Remove(keys[0]), "Removed the same element twice.");
+			AssertFalse(timerQueue.Contains(keys[0]), "Found removed element.");
+			AssertTrue(timerQueue.Remove(keys[15]), "Failed to remove middle element.");
+
+			UInt32 popped = timerQueue.Pop();
+			AssertEqual(popped, 101, "Incorrect element after removal.");
+			AssertFalse(timerQueue.Contains(keys[1]), "Found popped element.");
+			AssertFalse(timerQueue.Update(keys[1], 0), "Updated popped element.");
+
+			UInt32 previous = 0;
+			while (timerQueue.Length() > 0)
+			{
+				UInt32 element = timerQueue.Pop();
+				AssertTrue(element >= previous, "Heap order broken by updates.");
+				AssertTrue(element != 115, "Removed element was popped.");
+				previous = element;
+			}
+
+			AssertEqual(previous, 500, "Updated element was lost.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate updated PriorityQueue.");
+
+		return true;
+	}
+
+	bool PriorityQueueTests::HeapifyQueue()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			PriorityQueue<UInt32, Less, 3> intQueue;
+			SlotKey key = {};
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				SlotKey added = intQueue.AddUnsorted((i * 37) % 100);
+				if ((i * 37) % 100 == 42)
+				{
+					key = added;
+				}
+			}
+
+			intQueue.Heapify();
+			AssertEqual(*intQueue.Find(key), 42, "Heapify lost track of keys.");
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				AssertEqual(intQueue.Pop(), i, "Heapify produced an invalid heap.");
+			}
+
+			intQueue.Push(3);
+			intQueue.Clear();
+			AssertEqual(intQueue.Length(), 0, "Failed to clear PriorityQueue.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate heapified PriorityQueue.");
+
+		return true;
+	}
+
+	bool PriorityQueueTests::ObjectQueue()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			PriorityQueue<String, LongerString> stringQueue(1);
+
+			stringQueue.Push(String("aa"));
+			SlotKey key = stringQueue.Push(String("a"));
+			stringQueue.Push(String("aaaa"));
+			stringQueue.Push(String("aaa"));
+
+			stringQueue.Update(key, String("aaaaa"));
+
+			AssertTrue(stringQueue.Pop() == "aaaaa", "Incorrect String order.");
+			AssertTrue(stringQueue.Pop() == "aaaa", "Incorrect String order.");
+
+			PriorityQueue<String, LongerString> movedQueue(std::move(stringQueue));
+			AssertEqual(movedQueue.Length(), 2, "Failed to move PriorityQueue.");
+			AssertTrue(movedQueue.Pop() == "aaa", "Incorrect String order after move.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate String PriorityQueue.");
+
+		return true;
+	}
+
+	bool PriorityQueueTests::ArityBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			std::mt19937 random(11);
+			std::vector<UInt32> elements(200000);
+			for (UInt32& element : elements)
+			{
+				element = random();
+			}
+
+			UInt64 binaryChecksum = BenchmarkArity<2>(elements);
+			UInt64 quaternaryChecksum = BenchmarkArity<4>(elements);
+			UInt64 octonaryChecksum = BenchmarkArity<8>(elements);
+
+			Timer timer;
+			std::priority_queue<UInt32, std::vector<UInt32>, std::greater<UInt32>> stdQueue;
+			UInt64 stdChecksum = 0;
+
+			timer.Start();
+			for (UInt32 element : elements)
+			{
+				stdQueue.push(element);
+			}
+			while (!stdQueue.empty())
+			{
+				stdChecksum = stdChecksum * 31 + stdQueue.top();
+				stdQueue.pop();
+			}
+			timer.Stop();
+			SoulLogInfo("std::priority_queue %u push and pop: %f ms",
+				(UInt32)elements.size(), timer.GetElapsedMilliseconds());
+
+			AssertEqual(binaryChecksum, stdChecksum, "Mismatched 2-ary pop order.");
+			AssertEqual(quaternaryChecksum, stdChecksum, "Mismatched 4-ary pop order.");
+			AssertEqual(octonaryChecksum, stdChecksum, "Mismatched 8-ary pop order.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark queues.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+Tests for the PriorityQueue class.
+@file PriorityQueueTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the PriorityQueue class.
+	*/
+	class PriorityQueueTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PushAndPop();
+		bool UpdateAndRemove();
+		bool HeapifyQueue();
+		bool ObjectQueue();
+		bool ArityBenchmark();
+	};
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 Tests for the Queue class.
 @file QueueTests.cpp
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #include "QueueTests.h"
@@ -11,6 +11,9 @@ Tests for the Queue class.
 #include <TestsLib/TestMacros.h>
 #include <UtilsLib/CommonTypes.h>
 #include <UtilsLib/Containers/Queue.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
 
 namespace Soul
 {
@@ -19,6 +22,10 @@ namespace Soul
 		RunTest(PrimitiveQueue);
 		RunTest(ObjectQueue);
 		RunTest(QueueQueue);
+		RunTest(Wraparound);
+		RunTest(GrowQueue);
+		RunTest(BulkOperations);
+		RunTest(PushPopBenchmark);
 	}
 
 	bool QueueTests::PrimitiveQueue()
@@ -161,4 +168,151 @@ namespace Soul
 
 		return true;
 	}
+
+	bool QueueTests::Wraparound()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Queue<UInt32> intQueue(8, false);
+
+			/*
+			Keep the queue half full while cycling far past its capacity so
+			both the head and the tail wrap many times.
+			*/
+			for (UInt32 i = 0; i < 4; ++i)
+			{
+				intQueue.Push(i);
+			}
+
+			for (UInt32 i = 4; i < 1000; ++i)
+			{
+				AssertEqual(intQueue.Pop(), i - 4, "Queue failed to wrap around.");
+				intQueue.Push(i);
+			}
+
+			AssertEqual(intQueue.GetCapacity(), 8, "Fixed queue changed capacity.");
+			AssertEqual(intQueue.GetLength(), 4, "Incorrect queue length.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Wrapped queue was not properly deallocated.");
+
+		return true;
+	}
+
+	bool QueueTests::GrowQueue()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Queue<String> stringQueue(3);
+
+			AssertEqual(stringQueue.GetCapacity(), 4,
+				"Queue capacity wasn't rounded to a power of two.");
+
+			// Wrap the queue before making it grow.
+			stringQueue.Push(String("a"));
+			stringQueue.Push(String("b"));
+			stringQueue.Pop();
+			stringQueue.Pop();
+
+			const char* strings[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8" };
+			for (UInt32 i = 0; i < 9; ++i)
+			{
+				stringQueue.Push(String(strings[i]));
+			}
+
+			AssertEqual(stringQueue.GetCapacity(), 16, "Queue failed to grow.");
+
+			for (UInt32 i = 0; i < 9; ++i)
+			{
+				AssertTrue(stringQueue.Pop() == strings[i],
+					"Queue lost order while growing.");
+			}
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Grown queue was not properly deallocated.");
+
+		return true;
+	}
+
+	bool QueueTests::BulkOperations()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Queue<UInt32> intQueue(8);
+			UInt32 elements[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+			UInt32 elementsOut[12];
+
+			intQueue.PushN(elements, 6);
+			intQueue.PopN(elementsOut, 5);
+
+			AssertEqual(elementsOut[4], 4, "PopN returned the wrong elements.");
+
+			// This push wraps around the end of the buffer.
+			intQueue.PushN(elements + 6, 6);
+
+			AssertEqual(intQueue.GetCapacity(), 8, "Queue grew unnecessarily.");
+			AssertEqual(intQueue.Peek(), 5, "Incorrect front of queue.");
+			AssertEqual(intQueue.Peek(3), 8, "Incorrect peek at index.");
+
+			intQueue.PushN(elements, 12);
+
+			AssertEqual(intQueue.GetLength(), 19, "Incorrect queue length.");
+			AssertEqual(intQueue.Peek(7), 0, "Queue lost order while growing.");
+
+			intQueue.PopN(elementsOut, 7);
+
+			for (UInt32 i = 0; i < 7; ++i)
+			{
+				AssertEqual(elementsOut[i], i + 5, "PopN lost order.");
+			}
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Bulk queue was not properly deallocated.");
+
+		return true;
+	}
+
+	bool QueueTests::PushPopBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Queue<UInt32> intQueue(1024);
+			UInt64 sum = 0;
+
+			Timer timer;
+			timer.Start();
+			for (UInt32 i = 0; i < 1000000; ++i)
+			{
+				intQueue.Push(i);
+				if (intQueue.GetLength() == 512)
+				{
+					while (intQueue.GetLength() > 0)
+					{
+						sum += intQueue.Pop();
+					}
+				}
+			}
+			while (intQueue.GetLength() > 0)
+			{
+				sum += intQueue.Pop();
+			}
+			timer.Stop();
+			SoulLogInfo("Queue<UInt32> 1000000 Push/Pop: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(sum, 499999500000ULL, "Queue lost elements.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Benchmark queue was not properly deallocated.");
+
+		return true;
+	}
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 Tests for the Queue class.
 @file QueueTests.h
 @author Jacob Peterson
-@edited 12/26/2020
+@edited 10/19/26
 */
 
 #pragma once
@@ -24,5 +24,9 @@ namespace Soul
 		bool PrimitiveQueue();
 		bool ObjectQueue();
 		bool QueueQueue();
+		bool Wraparound();
+		bool GrowQueue();
+		bool BulkOperations();
+		bool PushPopBenchmark();
 	};
 }
\ No newline at end of file
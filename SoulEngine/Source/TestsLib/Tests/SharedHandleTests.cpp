@@ -0,0 +1,161 @@
+/*
+Tests for the SharedHandle class.
+@file SharedHandleTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "SharedHandleTests.h"
+
+#include <thread>
+
+#include <Memory/MemoryManager.h>
+#include <Memory/SharedHandle.h>
+#include <Memory/UniqueHandle.h>
+#include <TestsLib/TestMacros.h>
+
+namespace Soul
+{
+	void SharedHandleTests::RunAllTests()
+	{
+		RunTest(PrimitiveHandle);
+		RunTest(ObjectHandle);
+		RunTest(MoveHandle);
+		RunTest(Release);
+		RunTest(AtomicHandle);
+	}
+
+	bool SharedHandleTests::PrimitiveHandle()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SharedHandle<UInt32> sharedInt(MemoryManager::Allocate<UInt32>(5));
+			AssertEqual(sharedInt.GetReferenceCount(), 1, "Incorrect reference count.");
+
+			{
+				SharedHandle<UInt32> sharedInt2(sharedInt);
+				SharedHandle<UInt32> sharedInt3;
+				sharedInt3 = sharedInt2;
+
+				AssertEqual(sharedInt.GetReferenceCount(), 3,
+					"Incorrect reference count after copying.");
+				AssertEqual(*sharedInt3, 5, "Failed to share primitive.");
+
+				*sharedInt3 = 6;
+			}
+
+			AssertEqual(sharedInt.GetReferenceCount(), 1,
+				"Incorrect reference count after copies destroyed.");
+			AssertEqual(*sharedInt, 6, "Shared memory was not the same.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate shared primitive.");
+
+		return true;
+	}
+
+	bool SharedHandleTests::ObjectHandle()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		TestClass fakeClass = { 1, 'a', 2.5f };
+
+		{
+			SharedHandle<TestClass> sharedObject;
+
+			{
+				SharedHandle<TestClass> sharedObject2(
+					MemoryManager::Allocate<TestClass>(fakeClass));
+				sharedObject = sharedObject2;
+			}
+
+			AssertTrue(sharedObject.IsValid(), "Lost shared object.");
+			AssertEqual(*sharedObject, fakeClass, "Failed to share object.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate shared object.");
+
+		return true;
+	}
+
+	bool SharedHandleTests::MoveHandle()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SharedHandle<UInt32> sharedInt(MemoryManager::Allocate<UInt32>(1));
+			SharedHandle<UInt32> sharedInt2(std::move(sharedInt));
+
+			AssertFalse(sharedInt.IsValid(), "Moved from handle still valid.");
+			AssertEqual(sharedInt2.GetReferenceCount(), 1,
+				"Moving changed reference count.");
+
+			SharedHandle<UInt32> sharedInt3(MemoryManager::Allocate<UInt32>(2));
+			sharedInt3 = std::move(sharedInt2);
+
+			AssertEqual(*sharedInt3, 1, "Failed to move shared handle.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate moved shared handles.");
+
+		return true;
+	}
+
+	bool SharedHandleTests::Release()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		SharedHandle<UInt32> sharedInt(MemoryManager::Allocate<UInt32>(1));
+		SharedHandle<UInt32> sharedInt2(sharedInt);
+
+		sharedInt.Release();
+
+		AssertFalse(sharedInt.IsValid(), "Released handle still valid.");
+		AssertEqual(*sharedInt2, 1, "Memory released while still shared.");
+
+		sharedInt2.Release();
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate released handle.");
+
+		return true;
+	}
+
+	bool SharedHandleTests::AtomicHandle()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SharedHandle<UInt32, true> sharedInt(MemoryManager::Allocate<UInt32>(1));
+
+			auto copyHandle = [&sharedInt]() {
+				for (UInt32 i = 0; i < 10000; ++i)
+				{
+					SharedHandle<UInt32, true> copy(sharedInt);
+				}
+			};
+
+			std::thread threads[4];
+			for (std::thread& thread : threads)
+			{
+				thread = std::thread(copyHandle);
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			AssertEqual(sharedInt.GetReferenceCount(), 1,
+				"Atomic reference count lost updates.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate atomic shared handle.");
+
+		return true;
+	}
+}
\ No newline at end of file
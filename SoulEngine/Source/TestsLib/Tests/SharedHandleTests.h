@@ -0,0 +1,30 @@
+/*
+Tests for the SharedHandle class.
+@file SharedHandleTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+#include <TestsLib/TestClass.h>
+
+namespace Soul
+{
+	/*
+	Tests for the SharedHandle class.
+	*/
+	class SharedHandleTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PrimitiveHandle();
+		bool ObjectHandle();
+		bool MoveHandle();
+		bool Release();
+		bool AtomicHandle();
+	};
+}
\ No newline at end of file
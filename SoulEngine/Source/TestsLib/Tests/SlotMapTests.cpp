@@ -0,0 +1,195 @@
+/*
+Tests for the SlotMap class.
+@file SlotMapTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "SlotMapTests.h"
+
+#include <cstdio>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestClass.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/SlotMap.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/String.h>
+
+namespace Soul
+{
+	void SlotMapTests::RunAllTests()
+	{
+		RunTest(InsertAndFind);
+		RunTest(StaleKeys);
+		RunTest(DenseIteration);
+		RunTest(ObjectValues);
+	}
+
+	bool SlotMapTests::InsertAndFind()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SlotMap<UInt32> intMap(4);
+			Vector<SlotKey> keys(4);
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				keys.Push(intMap.Insert(i * 3));
+			}
+
+			AssertEqual(intMap.Length(), 100, "Incorrect SlotMap length.");
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				UInt32* value = intMap.Find(keys[i]);
+				AssertTrue(value != nullptr, "Failed to find key.");
+				AssertEqual(*value, i * 3, "Incorrect value for key.");
+			}
+
+			AssertFalse(intMap.Contains(SlotKey{ 0, 0 }),
+				"Zeroed key found an element.");
+			AssertFalse(intMap.Contains(SlotKey{ 1000, 1 }),
+				"Out of range key found an element.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate primitive SlotMap.");
+
+		return true;
+	}
+
+	bool SlotMapTests::StaleKeys()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SlotMap<UInt32> intMap;
+
+			SlotKey first = intMap.Insert(1);
+			SlotKey second = intMap.Insert(2);
+
+			AssertTrue(intMap.Remove(first), "Failed to remove key.");
+			AssertFalse(intMap.Remove(first), "Removed the same key twice.");
+			AssertFalse(intMap.Contains(first), "Found removed key.");
+
+			// The freed slot is reused, but the old key must not see the new element
+			SlotKey third = intMap.Insert(3);
+
+			AssertEqual(third.index, first.index, "Free slot was not reused.");
+			AssertTrue(third != first, "Reused slot kept its generation.");
+			AssertTrue(intMap.Find(first) == nullptr, "Stale key found an element.");
+			AssertEqual(*intMap.Find(third), 3, "Incorrect value for reused slot.");
+			AssertEqual(*intMap.Find(second), 2, "Incorrect value for untouched key.");
+
+			intMap.Clear();
+
+			AssertEqual(intMap.Length(), 0, "Failed to clear SlotMap.");
+			AssertFalse(intMap.Contains(second), "Found key after clearing.");
+			AssertFalse(intMap.Contains(third), "Found key after clearing.");
+
+			SlotKey fourth = intMap.Insert(4);
+			AssertEqual(*intMap.Find(fourth), 4, "Failed to insert after clearing.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate SlotMap.");
+
+		return true;
+	}
+
+	bool SlotMapTests::DenseIteration()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SlotMap<UInt32> intMap;
+			Vector<SlotKey> keys(16);
+
+			for (UInt32 i = 0; i < 10; ++i)
+			{
+				keys.Push(intMap.Insert(i));
+			}
+
+			// Remove every even element, swapping later elements into the holes
+			for (UInt32 i = 0; i < 10; i += 2)
+			{
+				intMap.Remove(keys[i]);
+			}
+
+			AssertEqual(intMap.Length(), 5, "Incorrect length after removal.");
+
+			UInt32 sum = 0;
+			for (ArraySize i = 0; i < intMap.Length(); ++i)
+			{
+				AssertTrue(intMap[i] % 2 == 1, "Removed element still iterated.");
+				AssertTrue(intMap.Find(intMap.GetKey(i)) == &intMap[i],
+					"Dense key does not point back at its element.");
+				sum += intMap[i];
+			}
+
+			AssertEqual(sum, 1 + 3 + 5 + 7 + 9, "Iteration missed elements.");
+
+			for (UInt32 i = 1; i < 10; i += 2)
+			{
+				AssertEqual(*intMap.Find(keys[i]), i, "Key lost its element after removal.");
+			}
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate SlotMap.");
+
+		return true;
+	}
+
+	bool SlotMapTests::ObjectValues()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SlotMap<String> stringMap(2);
+			Vector<SlotKey> keys(2);
+			char buffer[32];
+
+			for (UInt32 i = 0; i < 50; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "Entity%u", i);
+				keys.Push(stringMap.Emplace(buffer));
+			}
+
+			for (UInt32 i = 0; i < 50; i += 3)
+			{
+				stringMap.Remove(keys[i]);
+			}
+
+			for (UInt32 i = 0; i < 50; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "Entity%u", i);
+				const String* value = stringMap.Find(keys[i]);
+
+				if (i % 3 == 0)
+				{
+					AssertTrue(value == nullptr, "Found removed String.");
+				}
+				else
+				{
+					AssertTrue(value != nullptr, "Failed to find String.");
+					AssertTrue(*value == buffer, "Incorrect String for key.");
+				}
+			}
+
+			SlotMap<TestClass> classMap;
+			TestClass fakeClass = { 1, 'a', 1.5f };
+			SlotKey key = classMap.Insert(fakeClass);
+
+			SlotMap<TestClass> movedMap(std::move(classMap));
+			AssertEqual(*movedMap.Find(key), fakeClass, "Failed to move SlotMap.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate object SlotMap.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+/*
+Tests for the SlotMap class.
+@file SlotMapTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the SlotMap class.
+	*/
+	class SlotMapTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool InsertAndFind();
+		bool StaleKeys();
+		bool DenseIteration();
+		bool ObjectValues();
+	};
+}
\ No newline at end of file
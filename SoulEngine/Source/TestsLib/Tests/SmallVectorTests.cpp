@@ -0,0 +1,153 @@
+/*
+Tests for the SmallVector class.
+@file SmallVectorTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "SmallVectorTests.h"
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestClass.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/SmallVector.h>
+#include <UtilsLib/String.h>
+
+namespace Soul
+{
+	void SmallVectorTests::RunAllTests()
+	{
+		RunTest(InlineStorage);
+		RunTest(SpillToMemory);
+		RunTest(MoveVector);
+		RunTest(RemoveElements);
+	}
+
+	bool SmallVectorTests::InlineStorage()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		SmallVector<UInt32, 8> intVector;
+
+		for (UInt32 i = 0; i < 8; ++i)
+		{
+			intVector.Push(i);
+		}
+
+		AssertTrue(intVector.IsInline(), "SmallVector spilled too early.");
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Inline SmallVector allocated memory.");
+
+		for (UInt32 i = 0; i < 8; ++i)
+		{
+			AssertEqual(intVector.Pop(), 7 - i, "Failed to store primitive inline.");
+		}
+
+		return true;
+	}
+
+	bool SmallVectorTests::SpillToMemory()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SmallVector<String, 2> stringVector;
+			stringVector.EmplaceBack("zero");
+			stringVector.EmplaceBack("one");
+			stringVector.EmplaceBack("two");
+
+			AssertFalse(stringVector.IsInline(), "SmallVector failed to spill.");
+			AssertEqual(stringVector.Length(), 3, "Incorrect SmallVector length.");
+			AssertTrue(stringVector[0] == "zero", "Lost String while spilling.");
+			AssertTrue(stringVector[2] == "two", "Lost String while spilling.");
+
+			TestClass fakeClass = { 1, 'a', 1.2f };
+			SmallVector<TestClass, 1> classVector;
+
+			for (UInt8 i = 0; i < 20; ++i)
+			{
+				classVector.Push(fakeClass);
+			}
+
+			AssertEqual(classVector[19], fakeClass, "Lost object while spilling.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate spilled SmallVectors.");
+
+		return true;
+	}
+
+	bool SmallVectorTests::MoveVector()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SmallVector<String, 4> inlineVector;
+			inlineVector.EmplaceBack("inline");
+
+			SmallVector<String, 4> movedInline(std::move(inlineVector));
+
+			AssertEqual(inlineVector.Length(), 0, "Moved from SmallVector not empty.");
+			AssertTrue(movedInline[0] == "inline", "Failed to move inline SmallVector.");
+
+			SmallVector<String, 4> spilledVector;
+			for (UInt8 i = 0; i < 6; ++i)
+			{
+				spilledVector.EmplaceBack("spilled");
+			}
+
+			movedInline = std::move(spilledVector);
+
+			AssertEqual(movedInline.Length(), 6, "Failed to move spilled SmallVector.");
+			AssertFalse(movedInline.IsInline(), "Moved SmallVector lost its memory.");
+			AssertTrue(movedInline[5] == "spilled", "Failed to move spilled SmallVector.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate moved SmallVectors.");
+
+		return true;
+	}
+
+	bool SmallVectorTests::RemoveElements()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SmallVector<String, 4> stringVector;
+			stringVector.EmplaceBack("zero");
+			stringVector.EmplaceBack("one");
+			stringVector.EmplaceBack("two");
+			stringVector.EmplaceBack("three");
+
+			stringVector.Remove(0);
+			stringVector.SwapRemove(0);
+
+			AssertEqual(stringVector.Length(), 2, "Incorrect length after removals.");
+			AssertTrue(stringVector[0] == "three", "Incorrect String after removals.");
+			AssertTrue(stringVector[1] == "two", "Incorrect String after removals.");
+
+			TestClass fakeClass = { 1, 'a', 1.2f };
+			TestClass fakeClass2 = { 2, 'b', 2.4f };
+			SmallVector<TestClass, 2> classVector;
+			classVector.Push(fakeClass);
+			classVector.Push(fakeClass);
+			classVector.Push(fakeClass2);
+
+			classVector.SwapRemove(0);
+			classVector.Remove(1);
+
+			AssertEqual(classVector.Length(), 1, "Incorrect length after removals.");
+			AssertEqual(classVector[0], fakeClass2, "Incorrect object after removals.");
+
+			stringVector.Clear();
+			AssertEqual(stringVector.Length(), 0, "Failed to clear SmallVector.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate SmallVectors with removed elements.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+/*
+Tests for the SmallVector class.
+@file SmallVectorTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the SmallVector class.
+	*/
+	class SmallVectorTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool InlineStorage();
+		bool SpillToMemory();
+		bool MoveVector();
+		bool RemoveElements();
+	};
+}
\ No newline at end of file
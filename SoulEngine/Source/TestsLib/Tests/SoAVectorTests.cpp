@@ -0,0 +1,189 @@
+/*
+Tests for the SoAVector class.
+@file SoAVectorTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "SoAVectorTests.h"
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/SoAVector.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	struct SoAParticle
+	{
+		Float32 position[3];
+		Float32 velocity[3];
+		Float32 mass;
+		UInt32 flags;
+	};
+
+	void SoAVectorTests::RunAllTests()
+	{
+		RunTest(PushAndGet);
+		RunTest(AlignedColumns);
+		RunTest(ObjectColumns);
+		RunTest(ColumnBenchmark);
+	}
+
+	bool SoAVectorTests::PushAndGet()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SoAVector<Float32, UInt8, UInt64> soaVector(2);
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				soaVector.Push(i * 0.5f, (UInt8)i, (UInt64)i << 32);
+			}
+
+			AssertEqual(soaVector.Length(), 100, "Incorrect SoAVector length.");
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				AssertTrue(soaVector.Get<0>(i) == i * 0.5f, "Incorrect first column.");
+				AssertEqual(soaVector.Get<1>(i), (UInt8)i, "Incorrect second column.");
+				AssertEqual(soaVector.Get<2>(i), (UInt64)i << 32, "Incorrect third column.");
+			}
+
+			soaVector.SwapRemove(10);
+			AssertEqual(soaVector.Length(), 99, "Failed to swap remove row.");
+			AssertEqual(soaVector.Get<1>(10), 99, "Last row was not swapped in.");
+			AssertEqual(soaVector.Get<2>(10), 99ULL << 32, "Columns swapped unevenly.");
+
+			soaVector.Pop();
+			AssertEqual(soaVector.Length(), 98, "Failed to pop row.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate SoAVector.");
+
+		return true;
+	}
+
+	bool SoAVectorTests::AlignedColumns()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			// An odd sized allocation in front to knock the arena off alignment
+			Vector<UInt8> padding(3);
+			SoAVector<UInt8, Float32, Float64> soaVector(3);
+
+			for (UInt32 i = 0; i < 50; ++i)
+			{
+				soaVector.Push((UInt8)i, (Float32)i, (Float64)i);
+
+				AssertEqual((PtrSize)soaVector.GetColumn<0>() % 32, 0, "Misaligned column.");
+				AssertEqual((PtrSize)soaVector.GetColumn<1>() % 32, 0, "Misaligned column.");
+				AssertEqual((PtrSize)soaVector.GetColumn<2>() % 32, 0, "Misaligned column.");
+			}
+
+			Float64 sum = 0;
+			const Float64* column = soaVector.GetColumn<2>();
+			for (ArraySize i = 0; i < soaVector.Length(); ++i)
+			{
+				sum += column[i];
+			}
+
+			AssertTrue(sum == 49.0 * 50.0 / 2.0, "Column lost values during growth.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate aligned SoAVector.");
+
+		return true;
+	}
+
+	bool SoAVectorTests::ObjectColumns()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SoAVector<String, UInt32> soaVector(1);
+
+			for (UInt32 i = 0; i < 20; ++i)
+			{
+				soaVector.Push(String("Column"), i);
+			}
+
+			soaVector.SwapRemove(0);
+			soaVector.Pop();
+
+			AssertTrue(soaVector.Get<0>(0) == "Column", "String column corrupted.");
+			AssertEqual(soaVector.Get<1>(0), 19, "Last row was not swapped in.");
+
+			SoAVector<String, UInt32> movedVector(std::move(soaVector));
+			AssertEqual(movedVector.Length(), 18, "Failed to move SoAVector.");
+			AssertEqual(soaVector.Length(), 0, "Moved-from SoAVector not empty.");
+
+			movedVector.Clear();
+			movedVector.Push(String("Again"), 1);
+			AssertTrue(movedVector.Get<0>(0) == "Again", "Failed to push after clearing.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate String SoAVector.");
+
+		return true;
+	}
+
+	bool SoAVectorTests::ColumnBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			constexpr UInt32 count = 100000;
+			Timer timer;
+
+			Vector<SoAParticle> particles(count);
+			SoAVector<Float32, Float32, Float32, Float32, Float32, Float32, Float32,
+				UInt32> soaParticles(count);
+
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				SoAParticle particle = {};
+				particle.mass = (Float32)(i % 10);
+				particles.Push(particle);
+				soaParticles.Push(0, 0, 0, 0, 0, 0, particle.mass, 0);
+			}
+
+			Float32 aosSum = 0;
+			timer.Start();
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				aosSum += particles[i].mass;
+			}
+			timer.Stop();
+			SoulLogInfo("Vector<Particle> sum of one field over %u: %f ms", count,
+				timer.GetElapsedMilliseconds());
+
+			Float32 soaSum = 0;
+			timer.Reset();
+			timer.Start();
+			const Float32* masses = soaParticles.GetColumn<6>();
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				soaSum += masses[i];
+			}
+			timer.Stop();
+			SoulLogInfo("SoAVector sum of one column over %u: %f ms", count,
+				timer.GetElapsedMilliseconds());
+
+			AssertTrue(aosSum == soaSum, "Mismatched SoA and AoS sums.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark containers.");
+
+		return true;
+	}
+}
\ No newline at end of file
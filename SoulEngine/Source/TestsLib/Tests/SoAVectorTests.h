@@ -0,0 +1,28 @@
+/*
+Tests for the SoAVector class.
+@file SoAVectorTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the SoAVector class.
+	*/
+	class SoAVectorTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool PushAndGet();
+		bool AlignedColumns();
+		bool ObjectColumns();
+		bool ColumnBenchmark();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,303 @@
+/*
+Tests for the sorting routines.
+@file SortTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "SortTests.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/Sort.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	struct SortRecord
+	{
+		UInt32 key;
+		UInt32 order;
+	};
+
+	void SortTests::RunAllTests()
+	{
+		RunTest(RadixIntegers);
+		RunTest(RadixSignedAndFloats);
+		RunTest(RadixByKey);
+		RunTest(MergeSortObjects);
+		RunTest(ParallelMergeSort);
+		RunTest(SortBenchmark);
+	}
+
+	bool SortTests::RadixIntegers()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			std::mt19937 random(42);
+			Vector<UInt32> intVector(1000);
+			std::vector<UInt32> expected;
+
+			for (UInt32 i = 0; i < 1000; ++i)
+			{
+				UInt32 value = random();
+				intVector.Push(value);
+				expected.push_back(value);
+			}
+			std::sort(expected.begin(), expected.end());
+
+			RadixSort(intVector);
+
+			for (UInt32 i = 0; i < 1000; ++i)
+			{
+				AssertEqual(intVector[i], expected[i], "Incorrect RadixSort order.");
+			}
+
+			// Small keys only need their low byte pass
+			UInt64 smallKeys[] = { 5, 3, 200, 0, 3, 17 };
+			RadixSort(smallKeys, 6);
+
+			AssertEqual(smallKeys[0], 0, "Incorrect small key order.");
+			AssertEqual(smallKeys[2], 3, "Incorrect small key order.");
+			AssertEqual(smallKeys[5], 200, "Incorrect small key order.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate RadixSort scratch memory.");
+
+		return true;
+	}
+
+	bool SortTests::RadixSignedAndFloats()
+	{
+		Int32 ints[] = { 7, -1, 0, -2147483647 - 1, 2147483647, -50, 3 };
+		RadixSort(ints, 7);
+
+		for (UInt32 i = 1; i < 7; ++i)
+		{
+			AssertTrue(ints[i - 1] <= ints[i], "Incorrect signed RadixSort order.");
+		}
+
+		Float32 floats[] = { 1.5f, -0.25f, 0.0f, -100.0f, 3.75f, -1.5f, 1000.0f };
+		RadixSort(floats, 7);
+
+		for (UInt32 i = 1; i < 7; ++i)
+		{
+			AssertTrue(floats[i - 1] <= floats[i], "Incorrect float RadixSort order.");
+		}
+
+		Float64 doubles[] = { 2.0, -2.0, 0.5, -0.5 };
+		RadixSort(doubles, 4);
+
+		AssertTrue(doubles[0] == -2.0 && doubles[3] == 2.0,
+			"Incorrect double RadixSort order.");
+
+		return true;
+	}
+
+	bool SortTests::RadixByKey()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Vector<SortRecord> records(64);
+
+			for (UInt32 i = 0; i < 64; ++i)
+			{
+				records.Push(SortRecord{ (i * 7) % 5, i });
+			}
+
+			RadixSort(records, [](const SortRecord& record) {
+				return record.key;
+			});
+
+			for (UInt32 i = 1; i < 64; ++i)
+			{
+				AssertTrue(records[i - 1].key <= records[i].key,
+					"Incorrect RadixSort order by key.");
+				if (records[i - 1].key == records[i].key)
+				{
+					AssertTrue(records[i - 1].order < records[i].order,
+						"RadixSort is not stable.");
+				}
+			}
+
+			Vector<String> strings(8);
+			strings.Push(String("ccc"));
+			strings.Push(String("a"));
+			strings.Push(String("bb"));
+
+			RadixSort(strings, [](const String& string) {
+				return string.Length();
+			});
+
+			AssertTrue(strings[0] == "a" && strings[1] == "bb" && strings[2] == "ccc",
+				"Incorrect RadixSort order for Strings.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate RadixSort records.");
+
+		return true;
+	}
+
+	bool SortTests::MergeSortObjects()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Vector<String> strings(100);
+			char buffer[32];
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "%03u", (i * 37) % 100);
+				strings.Push(String(buffer));
+			}
+
+			MergeSort(strings, [](const String& a, const String& b) {
+				return strcmp(a.GetCString(), b.GetCString()) < 0;
+			});
+
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "%03u", i);
+				AssertTrue(strings[i] == buffer, "Incorrect MergeSort order.");
+			}
+
+			Vector<SortRecord> records(100);
+			for (UInt32 i = 0; i < 100; ++i)
+			{
+				records.Push(SortRecord{ 100 - i % 3, i });
+			}
+
+			MergeSort(records, [](const SortRecord& a, const SortRecord& b) {
+				return a.key < b.key;
+			});
+
+			for (UInt32 i = 1; i < 100; ++i)
+			{
+				if (records[i - 1].key == records[i].key)
+				{
+					AssertTrue(records[i - 1].order < records[i].order,
+						"MergeSort is not stable.");
+				}
+			}
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate MergeSort scratch memory.");
+
+		return true;
+	}
+
+	bool SortTests::ParallelMergeSort()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			std::mt19937 random(7);
+			Vector<UInt32> intVector(200000);
+			std::vector<UInt32> expected;
+
+			for (UInt32 i = 0; i < 200000; ++i)
+			{
+				UInt32 value = random() % 100000;
+				intVector.Push(value);
+				expected.push_back(value);
+			}
+			std::sort(expected.begin(), expected.end());
+
+			// Force several slices even on machines with few cores
+			MergeSort(intVector, Less(), 4);
+
+			for (UInt32 i = 0; i < 200000; ++i)
+			{
+				AssertEqual(intVector[i], expected[i], "Incorrect parallel MergeSort order.");
+			}
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate parallel MergeSort scratch memory.");
+
+		return true;
+	}
+
+	bool SortTests::SortBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			constexpr UInt32 count = 1000000;
+			std::mt19937 random(1);
+			Timer timer;
+
+			std::vector<UInt32> source(count);
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				source[i] = random();
+			}
+
+			std::vector<UInt32> stdVector(source);
+			timer.Start();
+			std::sort(stdVector.begin(), stdVector.end());
+			timer.Stop();
+			SoulLogInfo("std::sort 1000000 UInt32: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			Vector<UInt32> intVector(count);
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				intVector.Push(source[i]);
+			}
+			timer.Reset();
+			timer.Start();
+			RadixSort(intVector);
+			timer.Stop();
+			SoulLogInfo("RadixSort 1000000 UInt32: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(intVector[count / 2], stdVector[count / 2],
+				"Incorrect RadixSort benchmark order.");
+
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				intVector[i] = source[i];
+			}
+			timer.Reset();
+			timer.Start();
+			MergeSort(intVector, Less(), 1);
+			timer.Stop();
+			SoulLogInfo("MergeSort 1000000 UInt32, 1 thread: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				intVector[i] = source[i];
+			}
+			timer.Reset();
+			timer.Start();
+			MergeSort(intVector);
+			timer.Stop();
+			SoulLogInfo("MergeSort 1000000 UInt32, %u threads: %f ms",
+				std::thread::hardware_concurrency(), timer.GetElapsedMilliseconds());
+
+			AssertEqual(intVector[count / 2], stdVector[count / 2],
+				"Incorrect MergeSort benchmark order.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark Vectors.");
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+/*
+Tests for the sorting routines.
+@file SortTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the sorting routines.
+	*/
+	class SortTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool RadixIntegers();
+		bool RadixSignedAndFloats();
+		bool RadixByKey();
+		bool MergeSortObjects();
+		bool ParallelMergeSort();
+		bool SortBenchmark();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,317 @@
+/*
+Tests for the SPSCQueue and MPMCQueue classes.
+@file ThreadSafeQueueTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "ThreadSafeQueueTests.h"
+
+#include <atomic>
+#include <thread>
+
+#include <Memory/MemoryManager.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Threads/ThreadSafeQueue.h>
+#include <UtilsLib/Timer.h>
+
+namespace Soul
+{
+	void ThreadSafeQueueTests::RunAllTests()
+	{
+		RunTest(SingleThreaded);
+		RunTest(SPSCOrder);
+		RunTest(MPMCSum);
+		RunTest(ThroughputBenchmark);
+		RunTest(LatencyBenchmark);
+	}
+
+	bool ThreadSafeQueueTests::SingleThreaded()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			SPSCQueue<String> spscQueue(3);
+			MPMCQueue<String> mpmcQueue(3);
+			String element;
+
+			AssertEqual(spscQueue.GetCapacity(), 4, "Capacity not a power of two.");
+			AssertEqual(mpmcQueue.GetCapacity(), 4, "Capacity not a power of two.");
+
+			for (UInt32 i = 0; i < 4; ++i)
+			{
+				AssertTrue(spscQueue.TryPush(String("spsc")), "Failed to push.");
+				AssertTrue(mpmcQueue.TryPush(String("mpmc")), "Failed to push.");
+			}
+
+			AssertFalse(spscQueue.TryPush(String("full")), "Pushed to full queue.");
+			AssertFalse(mpmcQueue.TryPush(String("full")), "Pushed to full queue.");
+
+			for (UInt32 i = 0; i < 4; ++i)
+			{
+				AssertTrue(spscQueue.TryPop(element), "Failed to pop.");
+				AssertTrue(element == "spsc", "Incorrect element popped.");
+				AssertTrue(mpmcQueue.TryPop(element), "Failed to pop.");
+				AssertTrue(element == "mpmc", "Incorrect element popped.");
+			}
+
+			AssertFalse(spscQueue.TryPop(element), "Popped from empty queue.");
+			AssertFalse(mpmcQueue.TryPop(element), "Popped from empty queue.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate thread safe queues.");
+
+		return true;
+	}
+
+	bool ThreadSafeQueueTests::SPSCOrder()
+	{
+		const UInt32 elementCount = 200000;
+		SPSCQueue<UInt32> queue(1024);
+		bool inOrder = true;
+
+		std::thread consumer([&queue, &inOrder, elementCount]() {
+			UInt32 expected = 0;
+			UInt32 element;
+			while (expected < elementCount)
+			{
+				if (queue.TryPop(element))
+				{
+					inOrder = inOrder && element == expected;
+					++expected;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		for (UInt32 i = 0; i < elementCount; ++i)
+		{
+			while (!queue.TryPush(i))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		consumer.join();
+
+		AssertTrue(inOrder, "SPSCQueue delivered elements out of order.");
+
+		return true;
+	}
+
+	bool ThreadSafeQueueTests::MPMCSum()
+	{
+		const UInt32 threadCount = 4;
+		const UInt32 elementsPerThread = 20000;
+		MPMCQueue<UInt32> queue(256);
+		std::atomic<UInt64> sum(0);
+		std::atomic<UInt32> popped(0);
+
+		std::thread producers[threadCount];
+		std::thread consumers[threadCount];
+		for (UInt32 t = 0; t < threadCount; ++t)
+		{
+			producers[t] = std::thread([&queue, elementsPerThread]() {
+				for (UInt32 i = 1; i <= elementsPerThread; ++i)
+				{
+					while (!queue.TryPush(i))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+			consumers[t] = std::thread([&queue, &sum, &popped, threadCount,
+				elementsPerThread]() {
+				UInt32 element;
+				while (popped.load() < threadCount * elementsPerThread)
+				{
+					if (queue.TryPop(element))
+					{
+						sum += element;
+						++popped;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		for (UInt32 t = 0; t < threadCount; ++t)
+		{
+			producers[t].join();
+			consumers[t].join();
+		}
+
+		UInt64 expectedSum = (UInt64)threadCount * elementsPerThread *
+			(elementsPerThread + 1) / 2;
+		AssertEqual(sum.load(), expectedSum, "MPMCQueue lost or duplicated elements.");
+
+		return true;
+	}
+
+	bool ThreadSafeQueueTests::ThroughputBenchmark()
+	{
+		UInt32 maxThreads = std::thread::hardware_concurrency() / 2;
+		if (maxThreads < 1)
+		{
+			maxThreads = 1;
+		}
+		else if (maxThreads > 4)
+		{
+			maxThreads = 4;
+		}
+
+		const UInt32 elementsPerThread = 200000;
+		Timer timer;
+
+		/*
+		SPSC only ever has one thread on each end.
+		*/
+		{
+			SPSCQueue<UInt32> queue(1024);
+
+			timer.Start();
+			std::thread consumer([&queue, elementsPerThread]() {
+				UInt32 element;
+				for (UInt32 i = 0; i < elementsPerThread;)
+				{
+					if (queue.TryPop(element))
+					{
+						++i;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+			for (UInt32 i = 0; i < elementsPerThread;)
+			{
+				if (queue.TryPush(i))
+				{
+					++i;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+			consumer.join();
+			timer.Stop();
+
+			SoulLogInfo("SPSCQueue 1 producer / 1 consumer: %f elements/ms",
+				elementsPerThread / timer.GetElapsedMilliseconds());
+		}
+
+		/*
+		MPMC with 1 to N threads on each end.
+		*/
+		for (UInt32 threadCount = 1; threadCount <= maxThreads; ++threadCount)
+		{
+			MPMCQueue<UInt32> queue(1024);
+			std::thread producers[4];
+			std::thread consumers[4];
+
+			timer.Reset();
+			timer.Start();
+			for (UInt32 t = 0; t < threadCount; ++t)
+			{
+				producers[t] = std::thread([&queue, elementsPerThread]() {
+					for (UInt32 i = 0; i < elementsPerThread;)
+					{
+						if (queue.TryPush(i))
+						{
+							++i;
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+				});
+				consumers[t] = std::thread([&queue, elementsPerThread]() {
+					UInt32 element;
+					for (UInt32 i = 0; i < elementsPerThread;)
+					{
+						if (queue.TryPop(element))
+						{
+							++i;
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+				});
+			}
+			for (UInt32 t = 0; t < threadCount; ++t)
+			{
+				producers[t].join();
+				consumers[t].join();
+			}
+			timer.Stop();
+
+			SoulLogInfo("MPMCQueue %u producers / %u consumers: %f elements/ms",
+				threadCount, threadCount,
+				threadCount * elementsPerThread / timer.GetElapsedMilliseconds());
+		}
+
+		return true;
+	}
+
+	bool ThreadSafeQueueTests::LatencyBenchmark()
+	{
+		/*
+		Bounce a single element between two threads and time the round trips.
+		*/
+		const UInt32 roundTrips = 10000;
+		SPSCQueue<UInt32> ping(16);
+		SPSCQueue<UInt32> pong(16);
+
+		std::thread echo([&ping, &pong, roundTrips]() {
+			UInt32 element;
+			for (UInt32 i = 0; i < roundTrips; ++i)
+			{
+				while (!ping.TryPop(element))
+				{
+					std::this_thread::yield();
+				}
+				while (!pong.TryPush(element))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		Timer timer;
+		timer.Start();
+		UInt32 element = 0;
+		for (UInt32 i = 0; i < roundTrips; ++i)
+		{
+			while (!ping.TryPush(i))
+			{
+				std::this_thread::yield();
+			}
+			while (!pong.TryPop(element))
+			{
+				std::this_thread::yield();
+			}
+		}
+		timer.Stop();
+		echo.join();
+
+		AssertEqual(element, roundTrips - 1, "Round trip lost the element.");
+		SoulLogInfo("SPSCQueue round trip latency: %f us",
+			timer.GetElapsedMicroseconds() / roundTrips);
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+Tests for the SPSCQueue and MPMCQueue classes.
+@file ThreadSafeQueueTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the SPSCQueue and MPMCQueue classes.
+	*/
+	class ThreadSafeQueueTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool SingleThreaded();
+		bool SPSCOrder();
+		bool MPMCSum();
+		bool ThroughputBenchmark();
+		bool LatencyBenchmark();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+Tests for the UsageProfile class.
+@file UsageProfileTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "UsageProfileTests.h"
+
+#include <Events/EventBus.h>
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/UsageProfile.h>
+
+namespace Soul
+{
+	void UsageProfileTests::RunAllTests()
+	{
+		RunTest(DefaultSizes);
+		RunTest(CapturePeaks);
+		RunTest(SaveAndLoadProfile);
+	}
+
+	bool UsageProfileTests::DefaultSizes()
+	{
+		UsageProfile usageProfile;
+
+		AssertFalse(usageProfile.Load(
+			"C:/Programming/SoulEngine/SoulEngine/Data/MissingProfile.bin"),
+			"Loaded a profile that doesn't exist.");
+		AssertEqual(usageProfile.GetArenaByteSize(), Gigabytes(1),
+			"Incorrect default arena size.");
+		AssertEqual(usageProfile.GetVolatileByteSize(), Megabytes(8),
+			"Incorrect default volatile size.");
+		AssertEqual(usageProfile.GetEventCount(), 32,
+			"Incorrect default event count.");
+
+		return true;
+	}
+
+	bool UsageProfileTests::CapturePeaks()
+	{
+		ByteCount peakBytes = MemoryManager::GetPeakAllocatedBytes();
+		HandleTableSize peakHandles = MemoryManager::GetPeakHandleCount();
+
+		/*
+		A single block this big would skip the arena, so allocate more than
+		the peak as a batch of chunks that stay below the large allocation
+		threshold.
+		*/
+		{
+			ArraySize chunkCount = (ArraySize)(peakBytes / Kilobytes(256)) + 1;
+			UniqueHandle<ArraySize> chunkSizes =
+				MemoryManager::AllocateArray<ArraySize>(chunkCount);
+			UniqueHandle<UniqueHandle<Byte>> chunks =
+				MemoryManager::AllocateArray<UniqueHandle<Byte>>(chunkCount);
+			for (ArraySize i = 0; i < chunkCount; ++i)
+			{
+				chunkSizes[i] = Kilobytes(256);
+			}
+
+			MemoryManager::AllocateBatch<Byte>(chunkCount, chunkSizes.GetMemory(),
+				chunks.GetMemory());
+			MemoryManager::DeallocateBatch<Byte>(chunks.GetMemory(), chunkCount);
+		}
+
+		AssertTrue(MemoryManager::GetPeakAllocatedBytes() > peakBytes,
+			"Failed to record peak arena usage.");
+		AssertTrue(MemoryManager::GetPeakHandleCount() >= peakHandles,
+			"Peak handle count decreased.");
+
+		UsageProfile usageProfile;
+		usageProfile.Capture();
+
+		AssertTrue(usageProfile.GetArenaByteSize() >=
+			MemoryManager::GetPeakAllocatedBytes() * 2,
+			"Arena size doesn't cover peak usage.");
+		AssertTrue(usageProfile.GetHandleTableLength() >=
+			MemoryManager::GetPeakHandleCount(),
+			"Handle table doesn't cover peak usage.");
+		AssertTrue(usageProfile.GetEventCount() >= EventBus::GetPeakEventCount(),
+			"Event queue doesn't cover peak usage.");
+
+		return true;
+	}
+
+	bool UsageProfileTests::SaveAndLoadProfile()
+	{
+		const char* filePath =
+			"C:/Programming/SoulEngine/SoulEngine/Data/TestUsageProfile.bin";
+
+		UsageProfile savedProfile;
+		savedProfile.Capture();
+		savedProfile.Save(filePath);
+
+		UsageProfile loadedProfile;
+		AssertTrue(loadedProfile.Load(filePath), "Failed to load saved profile.");
+		DeleteFileA(filePath);
+
+		AssertEqual(savedProfile.GetArenaByteSize(), loadedProfile.GetArenaByteSize(),
+			"Incorrect arena size after loading.");
+		AssertEqual(savedProfile.GetVolatileByteSize(),
+			loadedProfile.GetVolatileByteSize(),
+			"Incorrect volatile size after loading.");
+		AssertEqual(savedProfile.GetHandleTableLength(),
+			loadedProfile.GetHandleTableLength(),
+			"Incorrect handle table length after loading.");
+		AssertEqual(savedProfile.GetEventCount(), loadedProfile.GetEventCount(),
+			"Incorrect event count after loading.");
+
+		return true;
+	}
+}
\ No newline at end of file
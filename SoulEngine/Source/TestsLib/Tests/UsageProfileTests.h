@@ -0,0 +1,27 @@
+/*
+Tests for the UsageProfile class.
+@file UsageProfileTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the UsageProfile class.
+	*/
+	class UsageProfileTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool DefaultSizes();
+		bool CapturePeaks();
+		bool SaveAndLoadProfile();
+	};
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 Tests for the Vector class.
 @file VectorTests.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #include "VectorTests.h"
@@ -11,6 +11,9 @@ Tests for the Vector class.
 #include <TestsLib/TestClass.h>
 #include <TestsLib/TestMacros.h>
 #include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Logger.h>
+#include <UtilsLib/String.h>
+#include <UtilsLib/Timer.h>
 
 namespace Soul
 {
@@ -21,6 +24,12 @@ namespace Soul
 		RunTest(VectorVector);
 		RunTest(ResizeVector);
 		RunTest(RemoveElements);
+		RunTest(StringVector);
+		RunTest(EmplaceAndInsert);
+		RunTest(RemoveRangeAndSwapRemove);
+		RunTest(ReserveAndShrink);
+		RunTest(ReuseMovedFromVector);
+		RunTest(PushRemoveBenchmark);
 	}
 
 	bool VectorTests::PrimitiveVector()
@@ -305,4 +314,253 @@ namespace Soul
 
 		return true;
 	}
+
+	bool VectorTests::StringVector()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			/*
+			Strings own deep data, so relocating them has to hand that data
+			over without freeing it.
+			*/
+			Vector<String> stringVector(1);
+			const char* words[] = { "zero", "one", "two", "three", "four" };
+
+			for (UInt8 i = 0; i < 5; ++i)
+			{
+				stringVector.Push(String(words[i]));
+			}
+
+			stringVector.Remove(0);
+			stringVector.Remove(2);
+
+			AssertEqual(stringVector.Length(), 3,
+				"Incorrect Vector length after removing Strings.");
+			AssertTrue(stringVector[0] == "one", "Incorrect String in Vector.");
+			AssertTrue(stringVector[1] == "two", "Incorrect String in Vector.");
+			AssertTrue(stringVector[2] == "four", "Incorrect String in Vector.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate Vector of Strings.");
+
+		return true;
+	}
+
+	bool VectorTests::EmplaceAndInsert()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			/*
+			Test with objects that have to be moved one at a time.
+			*/
+			Vector<TestClass> classVector(1);
+			TestClass fakeClass = { 1, 'a', 1.2f };
+			TestClass fakeClass2 = { 2, 'b', 2.4f };
+
+			classVector.EmplaceBack(1, 'a', 1.2f);
+			classVector.EmplaceBack(1, 'a', 1.2f);
+			classVector.Insert(1, fakeClass2);
+			classVector.Insert(0, fakeClass2);
+			classVector.Insert(4, fakeClass2);
+
+			AssertEqual(classVector.Length(), 5, "Incorrect Vector length.");
+			AssertEqual(classVector[0], fakeClass2, "Incorrect inserted object.");
+			AssertEqual(classVector[1], fakeClass, "Incorrect emplaced object.");
+			AssertEqual(classVector[2], fakeClass2, "Incorrect inserted object.");
+			AssertEqual(classVector[3], fakeClass, "Incorrect emplaced object.");
+			AssertEqual(classVector[4], fakeClass2, "Incorrect inserted object.");
+
+			/*
+			Test with Strings, which are relocated in bulk.
+			*/
+			Vector<String> stringVector(1);
+
+			stringVector.EmplaceBack("b");
+			stringVector.EmplaceBack("d");
+			stringVector.Insert(0, String("a"));
+			stringVector.Insert(2, String("c"));
+
+			AssertTrue(stringVector[0] == "a", "Incorrect inserted String.");
+			AssertTrue(stringVector[1] == "b", "Incorrect emplaced String.");
+			AssertTrue(stringVector[2] == "c", "Incorrect inserted String.");
+			AssertTrue(stringVector[3] == "d", "Incorrect emplaced String.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate Vectors with inserted elements.");
+
+		return true;
+	}
+
+	bool VectorTests::RemoveRangeAndSwapRemove()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Vector<UInt32> intVector(10);
+
+			for (UInt32 i = 0; i < 10; ++i)
+			{
+				intVector.Push(i);
+			}
+
+			intVector.RemoveRange(2, 3);
+
+			AssertEqual(intVector.Length(), 7, "Incorrect length after RemoveRange.");
+			AssertEqual(intVector[1], 1, "RemoveRange removed the wrong elements.");
+			AssertEqual(intVector[2], 5, "RemoveRange removed the wrong elements.");
+
+			intVector.SwapRemove(0);
+
+			AssertEqual(intVector.Length(), 6, "Incorrect length after SwapRemove.");
+			AssertEqual(intVector[0], 9, "SwapRemove didn't move the last element.");
+
+			Vector<String> stringVector(4);
+			stringVector.Push(String("zero"));
+			stringVector.Push(String("one"));
+			stringVector.Push(String("two"));
+			stringVector.Push(String("three"));
+
+			stringVector.SwapRemove(1);
+			stringVector.RemoveRange(0, 1);
+
+			AssertEqual(stringVector.Length(), 2, "Incorrect length after removals.");
+			AssertTrue(stringVector[0] == "three", "Incorrect String after removals.");
+			AssertTrue(stringVector[1] == "two", "Incorrect String after removals.");
+
+			Vector<TestClass> classVector(4);
+			TestClass fakeClass = { 1, 'a', 1.2f };
+			TestClass fakeClass2 = { 2, 'b', 2.4f };
+			classVector.Push(fakeClass);
+			classVector.Push(fakeClass);
+			classVector.Push(fakeClass2);
+
+			classVector.SwapRemove(0);
+			classVector.RemoveRange(1, 1);
+
+			AssertEqual(classVector.Length(), 1, "Incorrect length after removals.");
+			AssertEqual(classVector[0], fakeClass2, "Incorrect object after removals.");
+
+			stringVector.Clear();
+			AssertEqual(stringVector.Length(), 0, "Failed to clear Vector.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate Vectors with removed ranges.");
+
+		return true;
+	}
+
+	bool VectorTests::ReserveAndShrink()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Vector<String> stringVector(1);
+			stringVector.Reserve(64);
+
+			AssertEqual(stringVector.Capacity(), 64, "Failed to reserve capacity.");
+
+			for (UInt32 i = 0; i < 64; ++i)
+			{
+				stringVector.EmplaceBack("reserved");
+			}
+
+			AssertEqual(stringVector.Capacity(), 64, "Vector resized after Reserve.");
+
+			stringVector.RemoveRange(8, 56);
+			stringVector.ShrinkToFit();
+
+			AssertEqual(stringVector.Capacity(), 8, "Failed to shrink Vector.");
+			AssertTrue(stringVector[7] == "reserved", "Lost String while shrinking.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate reserved Vector.");
+
+		return true;
+	}
+
+	bool VectorTests::ReuseMovedFromVector()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Vector<String> source(4);
+			source.Push("moved");
+			Vector<String> destination(std::move(source));
+
+			AssertEqual(source.Length(), 0, "Moved from Vector isn't empty.");
+
+			source.Push("first");
+			source.EmplaceBack("second");
+			source.Reserve(16);
+
+			AssertEqual(source.Length(), 2, "Failed to push into moved from Vector.");
+			AssertTrue(source[1] == "second", "Moved from Vector lost an element.");
+			AssertTrue(destination[0] == "moved", "Move lost the Vector's contents.");
+
+			Vector<UInt32> primitives(4);
+			Vector<UInt32> other(1);
+			other = std::move(primitives);
+			primitives.Push(7);
+
+			AssertEqual(primitives[0], 7, "Failed to push into moved from Vector.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate reused Vector.");
+
+		return true;
+	}
+
+	bool VectorTests::PushRemoveBenchmark()
+	{
+		ByteCount initialBytes = MemoryManager::GetTotalAllocatedBytes();
+
+		{
+			Timer timer;
+
+			Vector<UInt32> intVector(1);
+			timer.Start();
+			for (UInt32 i = 0; i < 100000; ++i)
+			{
+				intVector.Push(i);
+			}
+			for (UInt32 i = 0; i < 1000; ++i)
+			{
+				intVector.Remove(0);
+			}
+			timer.Stop();
+			SoulLogInfo("Vector<UInt32> 100000 Push, 1000 Remove: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(intVector[0], 1000, "Incorrect element after Remove.");
+
+			Vector<String> stringVector(1);
+			timer.Reset();
+			timer.Start();
+			for (UInt32 i = 0; i < 2000; ++i)
+			{
+				stringVector.Push(String("benchmark"));
+			}
+			for (UInt32 i = 0; i < 1000; ++i)
+			{
+				stringVector.Remove(0);
+			}
+			timer.Stop();
+			SoulLogInfo("Vector<String> 2000 Push, 1000 Remove: %f ms",
+				timer.GetElapsedMilliseconds());
+
+			AssertEqual(stringVector.Length(), 1000, "Incorrect Vector length.");
+		}
+
+		AssertEqual(initialBytes, MemoryManager::GetTotalAllocatedBytes(),
+			"Failed to deallocate benchmark Vectors.");
+
+		return true;
+	}
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 Tests for the Vector class.
 @file VectorTests.h
 @author Jacob Peterson
-@edited 12/26/2020
+@edited 10/19/26
 */
 
 #pragma once
@@ -25,5 +25,11 @@ namespace Soul
 		bool VectorVector();
 		bool ResizeVector();
 		bool RemoveElements();
+		bool StringVector();
+		bool EmplaceAndInsert();
+		bool RemoveRangeAndSwapRemove();
+		bool ReserveAndShrink();
+		bool ReuseMovedFromVector();
+		bool PushRemoveBenchmark();
 	};
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+/*
+Tests for the WorkerPool class.
+@file WorkerPoolTests.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "WorkerPoolTests.h"
+
+#include <atomic>
+#include <thread>
+
+#include <TestsLib/TestMacros.h>
+#include <UtilsLib/Threads/WorkerPool.h>
+
+namespace Soul
+{
+	void WorkerPoolTests::RunAllTests()
+	{
+		RunTest(RunsEveryJob);
+		RunTest(RepeatedRuns);
+		RunTest(NoWorkers);
+	}
+
+	bool WorkerPoolTests::RunsEveryJob()
+	{
+		WorkerPool pool(3);
+		std::atomic<UInt32> runCounts[1000];
+		for (UInt32 i = 0; i < 1000; ++i)
+		{
+			runCounts[i].store(0);
+		}
+
+		pool.Run(1000, [&runCounts](ArraySize jobIndex) {
+			runCounts[jobIndex].fetch_add(1);
+		});
+
+		for (UInt32 i = 0; i < 1000; ++i)
+		{
+			AssertEqual(runCounts[i].load(), 1, "Job didn't run exactly once.");
+		}
+
+		return true;
+	}
+
+	bool WorkerPoolTests::RepeatedRuns()
+	{
+		WorkerPool pool(3);
+		std::atomic<UInt64> sum(0);
+
+		// Back to back runs catch workers that miss or overlap a barrier.
+		for (UInt64 run = 0; run < 1000; ++run)
+		{
+			pool.Run(4, [&sum](ArraySize jobIndex) {
+				sum.fetch_add(jobIndex + 1);
+			});
+			AssertEqual(sum.load(), (run + 1) * 10, "Run returned before its jobs finished.");
+		}
+
+		pool.Run(0, [](ArraySize jobIndex) {});
+
+		return true;
+	}
+
+	bool WorkerPoolTests::NoWorkers()
+	{
+		WorkerPool pool(0);
+		std::thread::id callerId = std::this_thread::get_id();
+		bool onCaller = true;
+		UInt32 runCount = 0;
+
+		pool.Run(10, [&onCaller, &runCount, callerId](ArraySize jobIndex) {
+			onCaller = onCaller && std::this_thread::get_id() == callerId;
+			++runCount;
+		});
+
+		AssertEqual(pool.GetThreadCount(), 0, "Pool started threads.");
+		AssertTrue(onCaller, "Jobs ran off the calling thread.");
+		AssertEqual(runCount, 10, "Not every job ran.");
+
+		return true;
+	}
+}
\ No newline at end of file
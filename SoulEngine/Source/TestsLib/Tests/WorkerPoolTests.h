@@ -0,0 +1,27 @@
+/*
+Tests for the WorkerPool class.
+@file WorkerPoolTests.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <TestsLib/ITestSuite.h>
+
+namespace Soul
+{
+	/*
+	Tests for the WorkerPool class.
+	*/
+	class WorkerPoolTests : public ITestSuite
+	{
+	protected:
+		virtual void RunAllTests() override;
+
+	private:
+		bool RunsEveryJob();
+		bool RepeatedRuns();
+		bool NoWorkers();
+	};
+}
\ No newline at end of file
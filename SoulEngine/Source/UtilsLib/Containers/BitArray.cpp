@@ -0,0 +1,242 @@
+/*
+A resizable array of bits packed into 64 bit words.
+@file BitArray.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "BitArray.h"
+
+#include <cstring>
+#include <emmintrin.h>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <UtilsLib/Macros.h>
+
+namespace Soul
+{
+	BitArray::BitArray(ArraySize bitCount) :
+		m_WordCapacity(0),
+		m_BitCount(0)
+	{
+		Resize(bitCount);
+	}
+
+	BitArray::BitArray(BitArray&& otherArray) :
+		m_Words(std::move(otherArray.m_Words)),
+		m_WordCapacity(otherArray.m_WordCapacity),
+		m_BitCount(otherArray.m_BitCount)
+	{
+		otherArray.m_WordCapacity = 0;
+		otherArray.m_BitCount = 0;
+	}
+
+	BitArray& BitArray::operator=(BitArray&& otherArray)
+	{
+		m_Words = std::move(otherArray.m_Words);
+		m_WordCapacity = otherArray.m_WordCapacity;
+		m_BitCount = otherArray.m_BitCount;
+		otherArray.m_WordCapacity = 0;
+		otherArray.m_BitCount = 0;
+
+		return *this;
+	}
+
+	void BitArray::Assign(ArraySize index, bool value)
+	{
+		Assert(index < m_BitCount);
+
+		UInt64 mask = 1ULL << (index & 63);
+		UInt64& word = m_Words[index >> 6];
+		word = (word & ~mask) | (value ? mask : 0);
+	}
+
+	void BitArray::SetAll()
+	{
+		ArraySize wordCount = WordsFor(m_BitCount);
+		if (wordCount > 0)
+		{
+			memset(m_Words.GetMemory(), 0xFF, wordCount * sizeof(UInt64));
+			ClearTail();
+		}
+	}
+
+	void BitArray::ClearAll()
+	{
+		ArraySize wordCount = WordsFor(m_BitCount);
+		if (wordCount > 0)
+		{
+			memset(m_Words.GetMemory(), 0, wordCount * sizeof(UInt64));
+		}
+	}
+
+	void BitArray::Resize(ArraySize bitCount)
+	{
+		ArraySize oldWordCount = WordsFor(m_BitCount);
+		ArraySize wordCount = WordsFor(bitCount);
+
+		if (wordCount > m_WordCapacity)
+		{
+			// Words are trivially constructible, so they come back uninitialized.
+			UniqueHandle<UInt64> newWords = MemoryManager::AllocateArray<UInt64>(wordCount);
+			UInt64* words = newWords.GetMemory();
+			if (oldWordCount > 0)
+			{
+				memcpy(words, m_Words.GetMemory(), oldWordCount * sizeof(UInt64));
+			}
+			memset(words + oldWordCount, 0, (wordCount - oldWordCount) * sizeof(UInt64));
+
+			m_Words = std::move(newWords);
+			m_WordCapacity = wordCount;
+		}
+
+		// Clear dropped bits so that growing again brings them back clear.
+		if (bitCount < m_BitCount)
+		{
+			m_BitCount = bitCount;
+			ClearTail();
+			memset(m_Words.GetMemory() + wordCount, 0,
+				(oldWordCount - wordCount) * sizeof(UInt64));
+		}
+
+		m_BitCount = bitCount;
+	}
+
+	ArraySize BitArray::Count() const
+	{
+		ArraySize wordCount = WordsFor(m_BitCount);
+		if (wordCount == 0)
+		{
+			return 0;
+		}
+
+		const UInt64* words = m_Words.GetMemory();
+		ArraySize count = 0;
+		for (ArraySize i = 0; i < wordCount; ++i)
+		{
+			count += PopCount(words[i]);
+		}
+
+		return count;
+	}
+
+	ArraySize BitArray::FindFirstSet(ArraySize start) const
+	{
+		if (start >= m_BitCount)
+		{
+			return m_BitCount;
+		}
+
+		const UInt64* words = m_Words.GetMemory();
+		ArraySize wordCount = WordsFor(m_BitCount);
+		ArraySize i = start >> 6;
+
+		// Mask off the bits below start in the first word.
+		UInt64 word = words[i] & (~0ULL << (start & 63));
+		while (!word)
+		{
+			if (++i == wordCount)
+			{
+				return m_BitCount;
+			}
+			word = words[i];
+		}
+
+		return (i << 6) + CountTrailingZeros(word);
+	}
+
+	void BitArray::And(const BitArray& other)
+	{
+		Assert(other.m_BitCount == m_BitCount);
+
+		ArraySize wordCount = WordsFor(m_BitCount);
+		if (wordCount == 0)
+		{
+			return;
+		}
+
+		UInt64* words = m_Words.GetMemory();
+		const UInt64* otherWords = other.m_Words.GetMemory();
+		ArraySize i = 0;
+		for (; i + 2 <= wordCount; i += 2)
+		{
+			__m128i a = _mm_loadu_si128((const __m128i*)(words + i));
+			__m128i b = _mm_loadu_si128((const __m128i*)(otherWords + i));
+			_mm_storeu_si128((__m128i*)(words + i), _mm_and_si128(a, b));
+		}
+		for (; i < wordCount; ++i)
+		{
+			words[i] &= otherWords[i];
+		}
+	}
+
+	void BitArray::Or(const BitArray& other)
+	{
+		Assert(other.m_BitCount == m_BitCount);
+
+		ArraySize wordCount = WordsFor(m_BitCount);
+		if (wordCount == 0)
+		{
+			return;
+		}
+
+		UInt64* words = m_Words.GetMemory();
+		const UInt64* otherWords = other.m_Words.GetMemory();
+		ArraySize i = 0;
+		for (; i + 2 <= wordCount; i += 2)
+		{
+			__m128i a = _mm_loadu_si128((const __m128i*)(words + i));
+			__m128i b = _mm_loadu_si128((const __m128i*)(otherWords + i));
+			_mm_storeu_si128((__m128i*)(words + i), _mm_or_si128(a, b));
+		}
+		for (; i < wordCount; ++i)
+		{
+			words[i] |= otherWords[i];
+		}
+	}
+
+	void BitArray::AndNot(const BitArray& other)
+	{
+		Assert(other.m_BitCount == m_BitCount);
+
+		ArraySize wordCount = WordsFor(m_BitCount);
+		if (wordCount == 0)
+		{
+			return;
+		}
+
+		UInt64* words = m_Words.GetMemory();
+		const UInt64* otherWords = other.m_Words.GetMemory();
+		ArraySize i = 0;
+		for (; i + 2 <= wordCount; i += 2)
+		{
+			// _mm_andnot_si128 negates its first operand.
+			__m128i a = _mm_loadu_si128((const __m128i*)(words + i));
+			__m128i b = _mm_loadu_si128((const __m128i*)(otherWords + i));
+			_mm_storeu_si128((__m128i*)(words + i), _mm_andnot_si128(b, a));
+		}
+		for (; i < wordCount; ++i)
+		{
+			words[i] &= ~otherWords[i];
+		}
+	}
+
+	ArraySize BitArray::Length() const
+	{
+		return m_BitCount;
+	}
+
+	ArraySize BitArray::WordsFor(ArraySize bitCount)
+	{
+		return (bitCount + 63) >> 6;
+	}
+
+	void BitArray::ClearTail()
+	{
+		if (m_BitCount & 63)
+		{
+			m_Words[m_BitCount >> 6] &= (1ULL << (m_BitCount & 63)) - 1;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+/*
+A resizable array of bits packed into 64 bit words.
+@file BitArray.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <type_traits>
+
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Maths/Functions.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	A compact set of flags, one bit each, for things like visibility, dirty
+	and occupancy masks. Bits are packed into UInt64 words allocated through
+	the MemoryManager, so counting and searching work a word at a time and
+	And(), Or() and AndNot() combine two whole arrays with SSE2.
+
+	Bits past Length() are always kept clear. A zeroed BitArray is a valid,
+	empty BitArray.
+	*/
+	class BitArray
+	{
+	public:
+		/*
+		@param bitCount - Number of bits in the array, all initially clear.
+		*/
+		BitArray(ArraySize bitCount = 0);
+		BitArray(BitArray&& otherArray);
+
+		BitArray& operator=(BitArray&& otherArray);
+
+		/*
+		Sets the bit at the given index.
+
+		@param index - Index of the bit, less than Length().
+		*/
+		void Set(ArraySize index);
+
+		/*
+		Clears the bit at the given index.
+
+		@param index - Index of the bit, less than Length().
+		*/
+		void Clear(ArraySize index);
+
+		/*
+		Sets or clears the bit at the given index.
+
+		@param index - Index of the bit, less than Length().
+
+		@param value - Whether the bit should be set.
+		*/
+		void Assign(ArraySize index, bool value);
+
+		/*
+		Returns whether the bit at the given index is set.
+
+		@param index - Index of the bit, less than Length().
+
+		@return Whether the bit is set.
+		*/
+		bool Test(ArraySize index) const;
+
+		/*
+		Sets every bit.
+		*/
+		void SetAll();
+
+		/*
+		Clears every bit.
+		*/
+		void ClearAll();
+
+		/*
+		Changes the number of bits in this BitArray. Bits that are added start
+		out clear.
+
+		@param bitCount - The new number of bits.
+		*/
+		void Resize(ArraySize bitCount);
+
+		/*
+		Counts the set bits.
+
+		@return ArraySize containing the number of set bits.
+		*/
+		ArraySize Count() const;
+
+		/*
+		Finds the first set bit at or after the given index.
+
+		@param start - Index to start searching from.
+
+		@return Index of the set bit, or Length() if there is none.
+		*/
+		ArraySize FindFirstSet(ArraySize start = 0) const;
+
+		/*
+		Calls the given function with the index of every set bit, in order.
+		Skips clear words entirely and jumps between set bits with
+		CountTrailingZeros.
+
+		@param function - Callable taking (ArraySize index).
+		*/
+		template <class Function>
+		void ForEachSetBit(Function function) const;
+
+		/*
+		Clears every bit that is clear in the other BitArray.
+
+		@param other - BitArray of the same length.
+		*/
+		void And(const BitArray& other);
+
+		/*
+		Sets every bit that is set in the other BitArray.
+
+		@param other - BitArray of the same length.
+		*/
+		void Or(const BitArray& other);
+
+		/*
+		Clears every bit that is set in the other BitArray.
+
+		@param other - BitArray of the same length.
+		*/
+		void AndNot(const BitArray& other);
+
+		/*
+		Gets the number of bits in this BitArray.
+
+		@return ArraySize containing the number of bits.
+		*/
+		ArraySize Length() const;
+
+		BitArray(const BitArray&) = delete;
+		BitArray& operator=(const BitArray&) = delete;
+
+	private:
+		/*
+		Gets the number of words needed to hold the given number of bits.
+
+		@param bitCount - Number of bits.
+
+		@return ArraySize containing the number of words.
+		*/
+		static ArraySize WordsFor(ArraySize bitCount);
+
+		/*
+		Clears the unused bits at the end of the last word.
+		*/
+		void ClearTail();
+
+	private:
+		UniqueHandle<UInt64> m_Words; // The packed bits.
+		ArraySize m_WordCapacity; // Number of words in m_Words.
+		ArraySize m_BitCount; // Number of bits in use.
+	};
+
+	inline void BitArray::Set(ArraySize index)
+	{
+		Assert(index < m_BitCount);
+
+		m_Words[index >> 6] |= 1ULL << (index & 63);
+	}
+
+	inline void BitArray::Clear(ArraySize index)
+	{
+		Assert(index < m_BitCount);
+
+		m_Words[index >> 6] &= ~(1ULL << (index & 63));
+	}
+
+	inline bool BitArray::Test(ArraySize index) const
+	{
+		Assert(index < m_BitCount);
+
+		return (m_Words[index >> 6] >> (index & 63)) & 1;
+	}
+
+	template <class Function>
+	void BitArray::ForEachSetBit(Function function) const
+	{
+		ArraySize wordCount = WordsFor(m_BitCount);
+		if (wordCount == 0)
+		{
+			return;
+		}
+
+		const UInt64* words = m_Words.GetMemory();
+		for (ArraySize i = 0; i < wordCount; ++i)
+		{
+			UInt64 word = words[i];
+			while (word)
+			{
+				function((i << 6) + CountTrailingZeros(word));
+				word &= word - 1;
+			}
+		}
+	}
+
+	template <>
+	struct IsTriviallyRelocatable<BitArray> : std::true_type {};
+}
\ No newline at end of file
@@ -0,0 +1,303 @@
+/*
+A self-resizing array that grows by adding fixed-size chunks, so its elements
+never move.
+@file BucketArray.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	A self-resizing array made of ChunkSize-element chunks. Growing only ever
+	allocates a new chunk, so pushing never moves the existing elements and
+	pointers to them stay valid until the element is popped. The chunks are
+	immovable in the MemoryManager for the same reason.
+
+	ChunkSize is a power of two, so indexing compiles down to a shift and a
+	mask into the chunk table. ForEachChunk() hands out each chunk as one
+	contiguous run for tight loops.
+	*/
+	template <class T, ArraySize ChunkSize = 64>
+	class BucketArray
+	{
+		static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+			"BucketArray chunk size must be a power of two.");
+
+	public:
+		BucketArray();
+		BucketArray(BucketArray&& otherArray);
+
+		~BucketArray();
+
+		BucketArray<T, ChunkSize>& operator=(BucketArray&& otherArray);
+		T& operator[](ArraySize index);
+		const T& operator[](ArraySize index) const;
+
+		/*
+		Adds a new element to the end of this BucketArray.
+
+		@param element - The element to add to this BucketArray.
+
+		@return Reference to the added element, valid until it is popped.
+		*/
+		T& Push(const T& element);
+
+		/*
+		Adds a new element to the end of this BucketArray.
+
+		@param element - The element to add to this BucketArray.
+
+		@return Reference to the added element, valid until it is popped.
+		*/
+		T& Push(T&& element);
+
+		/*
+		Constructs a new element in place at the end of this BucketArray.
+
+		@param args - Arguments forwarded to the element's constructor.
+
+		@return Reference to the added element, valid until it is popped.
+		*/
+		template <class... Args>
+		T& EmplaceBack(Args&&... args);
+
+		/*
+		Removes the last element of this BucketArray and returns it.
+
+		@return The element that used to be at the end of this BucketArray.
+		*/
+		T Pop();
+
+		/*
+		Destructs every element. The chunks are kept for reuse.
+		*/
+		void Clear();
+
+		/*
+		Allocates chunks until this BucketArray can hold at least the given
+		number of elements.
+
+		@param capacity - The number of elements to make room for.
+		*/
+		void Reserve(ArraySize capacity);
+
+		/*
+		Calls the given function once per chunk with the chunk's live
+		elements, in index order.
+
+		@param function - Callable taking (T* elements, ArraySize count).
+		*/
+		template <class Function>
+		void ForEachChunk(Function&& function);
+
+		/*
+		Gets the current number of elements in this BucketArray.
+
+		@return ArraySize containing the number of elements.
+		*/
+		ArraySize Length() const;
+
+		/*
+		Gets the number of elements this BucketArray can hold before it needs
+		another chunk.
+
+		@return ArraySize containing the capacity.
+		*/
+		ArraySize Capacity() const;
+
+		BucketArray(const BucketArray&) = delete;
+		BucketArray<T, ChunkSize>& operator=(const BucketArray&) = delete;
+
+	private:
+		/*
+		Allocates one more chunk and appends it to the chunk table.
+		*/
+		void AddChunk();
+
+	private:
+		Vector<UniqueHandle<T>> m_ChunkHandles; // Owns the chunks.
+		Vector<T*> m_Chunks; // Cached chunk memory, safe since chunks are immovable.
+		ArraySize m_Length; // Number of live elements.
+	};
+
+	template <class T, ArraySize ChunkSize>
+	BucketArray<T, ChunkSize>::BucketArray() :
+		m_ChunkHandles(4),
+		m_Chunks(4),
+		m_Length(0)
+	{
+	}
+
+	template <class T, ArraySize ChunkSize>
+	BucketArray<T, ChunkSize>::BucketArray(BucketArray&& otherArray) :
+		m_ChunkHandles(std::move(otherArray.m_ChunkHandles)),
+		m_Chunks(std::move(otherArray.m_Chunks)),
+		m_Length(otherArray.m_Length)
+	{
+		otherArray.m_Length = 0;
+	}
+
+	template <class T, ArraySize ChunkSize>
+	BucketArray<T, ChunkSize>::~BucketArray()
+	{
+		// Only the live elements need destructing; the rest are zeroed.
+		Clear();
+	}
+
+	template <class T, ArraySize ChunkSize>
+	BucketArray<T, ChunkSize>& BucketArray<T, ChunkSize>::operator=(BucketArray&& otherArray)
+	{
+		if (this == &otherArray)
+		{
+			return *this;
+		}
+
+		Clear();
+		m_ChunkHandles = std::move(otherArray.m_ChunkHandles);
+		m_Chunks = std::move(otherArray.m_Chunks);
+		m_Length = otherArray.m_Length;
+		otherArray.m_Length = 0;
+
+		return *this;
+	}
+
+	template <class T, ArraySize ChunkSize>
+	T& BucketArray<T, ChunkSize>::operator[](ArraySize index)
+	{
+		Assert(index < m_Length);
+
+		return m_Chunks[index / ChunkSize][index % ChunkSize];
+	}
+
+	template <class T, ArraySize ChunkSize>
+	const T& BucketArray<T, ChunkSize>::operator[](ArraySize index) const
+	{
+		Assert(index < m_Length);
+
+		return m_Chunks[index / ChunkSize][index % ChunkSize];
+	}
+
+	template <class T, ArraySize ChunkSize>
+	T& BucketArray<T, ChunkSize>::Push(const T& element)
+	{
+		return EmplaceBack(element);
+	}
+
+	template <class T, ArraySize ChunkSize>
+	T& BucketArray<T, ChunkSize>::Push(T&& element)
+	{
+		return EmplaceBack(std::move(element));
+	}
+
+	template <class T, ArraySize ChunkSize>
+	template <class... Args>
+	T& BucketArray<T, ChunkSize>::EmplaceBack(Args&&... args)
+	{
+		if (m_Length == Capacity())
+		{
+			AddChunk();
+		}
+
+		T* slot = m_Chunks[m_Length / ChunkSize] + (m_Length % ChunkSize);
+		++m_Length;
+
+		return *new (slot) T(std::forward<Args>(args)...);
+	}
+
+	template <class T, ArraySize ChunkSize>
+	T BucketArray<T, ChunkSize>::Pop()
+	{
+		Assert(m_Length > 0);
+
+		--m_Length;
+		T* slot = m_Chunks[m_Length / ChunkSize] + (m_Length % ChunkSize);
+		T element(std::move(*slot));
+
+		slot->~T();
+		if constexpr (!std::is_trivially_copyable<T>::value)
+		{
+			memset(slot, 0, sizeof(T));
+		}
+
+		return element;
+	}
+
+	template <class T, ArraySize ChunkSize>
+	void BucketArray<T, ChunkSize>::Clear()
+	{
+		if constexpr (!std::is_trivially_copyable<T>::value)
+		{
+			ForEachChunk([](T* elements, ArraySize count) {
+				for (ArraySize i = 0; i < count; ++i)
+				{
+					elements[i].~T();
+				}
+				memset(elements, 0, count * sizeof(T));
+			});
+		}
+
+		m_Length = 0;
+	}
+
+	template <class T, ArraySize ChunkSize>
+	void BucketArray<T, ChunkSize>::Reserve(ArraySize capacity)
+	{
+		while (Capacity() < capacity)
+		{
+			AddChunk();
+		}
+	}
+
+	template <class T, ArraySize ChunkSize>
+	template <class Function>
+	void BucketArray<T, ChunkSize>::ForEachChunk(Function&& function)
+	{
+		ArraySize remaining = m_Length;
+		for (ArraySize i = 0; remaining > 0; ++i)
+		{
+			ArraySize count = remaining < ChunkSize ? remaining : ChunkSize;
+			function(m_Chunks[i], count);
+			remaining -= count;
+		}
+	}
+
+	template <class T, ArraySize ChunkSize>
+	ArraySize BucketArray<T, ChunkSize>::Length() const
+	{
+		return m_Length;
+	}
+
+	template <class T, ArraySize ChunkSize>
+	ArraySize BucketArray<T, ChunkSize>::Capacity() const
+	{
+		return m_Chunks.Length() * ChunkSize;
+	}
+
+	template <class T, ArraySize ChunkSize>
+	void BucketArray<T, ChunkSize>::AddChunk()
+	{
+		UniqueHandle<T> chunk = MemoryManager::AllocateArray<T>(ChunkSize);
+		chunk.SetImmovable(true);
+
+		m_Chunks.Push(chunk.GetMemory());
+		m_ChunkHandles.Push(std::move(chunk));
+	}
+
+	template <class T, ArraySize ChunkSize>
+	struct IsTriviallyRelocatable<BucketArray<T, ChunkSize>> : std::true_type {};
+}
\ No newline at end of file
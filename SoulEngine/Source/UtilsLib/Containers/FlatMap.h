@@ -0,0 +1,442 @@
+/*
+A map that keeps its keys sorted in one contiguous array.
+@file FlatMap.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <utility>
+
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Sort.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	A map for small to medium, read-mostly tables. Keys are kept sorted in
+	one Vector and values in a parallel Vector, so a lookup is a branchless
+	binary search over densely packed keys with no per-entry overhead.
+
+	Inserting one entry at a time shifts the entries after it. To fill a
+	large table, AddUnsorted() every entry and then call Build() once, which
+	sorts everything in one go. Lookups are only valid after Build().
+	*/
+	template <class K, class V, class Compare = Less>
+	class FlatMap
+	{
+	public:
+		/*
+		@param capacity - Number of preallocated entries.
+		*/
+		FlatMap(ArraySize capacity = 16);
+		FlatMap(FlatMap&& otherMap);
+
+		FlatMap<K, V, Compare>& operator=(FlatMap&& otherMap);
+
+		/*
+		Gets the value stored under the given key, inserting a default
+		constructed value if the key isn't in this FlatMap yet.
+
+		@param key - The key to look up.
+
+		@return Reference to the value stored under the key.
+		*/
+		V& operator[](const K& key);
+
+		/*
+		Adds a key and value pair in sorted position if the key isn't in this
+		FlatMap yet.
+
+		@param key - The key to insert.
+
+		@param value - The value to store under the key.
+
+		@return Whether the pair was inserted.
+		*/
+		bool Insert(const K& key, const V& value);
+
+		/*
+		Adds a key and value pair in sorted position if the key isn't in this
+		FlatMap yet.
+
+		@param key - The key to insert.
+
+		@param value - The value to store under the key.
+
+		@return Whether the pair was inserted.
+		*/
+		bool Insert(K&& key, V&& value);
+
+		/*
+		Appends a key and value pair without keeping the keys sorted. Call
+		Build() once every pair has been added. If a key is added more than
+		once, the last value added wins.
+
+		@param key - The key to add.
+
+		@param value - The value to store under the key.
+		*/
+		void AddUnsorted(const K& key, const V& value);
+
+		/*
+		Appends a key and value pair without keeping the keys sorted. Call
+		Build() once every pair has been added. If a key is added more than
+		once, the last value added wins.
+
+		@param key - The key to add.
+
+		@param value - The value to store under the key.
+		*/
+		void AddUnsorted(K&& key, V&& value);
+
+		/*
+		Sorts the pairs added with AddUnsorted() and drops duplicate keys.
+		*/
+		void Build();
+
+		/*
+		Finds the value stored under the given key.
+
+		@param key - The key to look up.
+
+		@return Pointer to the value, or nullptr if the key isn't present.
+		*/
+		V* Find(const K& key);
+		const V* Find(const K& key) const;
+
+		/*
+		Returns whether the given key is in this FlatMap.
+
+		@param key - The key to look up.
+
+		@return Whether the key is present.
+		*/
+		bool Contains(const K& key) const;
+
+		/*
+		Removes the given key and its value.
+
+		@param key - The key to remove.
+
+		@return Whether the key was present.
+		*/
+		bool Remove(const K& key);
+
+		/*
+		Removes every key and value from this FlatMap.
+		*/
+		void Clear();
+
+		/*
+		Preallocates room for the given number of entries.
+
+		@param capacity - The number of entries to make room for.
+		*/
+		void Reserve(ArraySize capacity);
+
+		/*
+		Calls the provided function with every key and value in this FlatMap,
+		in key order.
+
+		@param function - Callable taking (const K& key, V& value).
+		*/
+		template <class Function>
+		void ForEach(Function function);
+
+		/*
+		Gets the key at the given position in sorted order.
+
+		@param index - Position of the entry, less than Length().
+
+		@return Reference to the key.
+		*/
+		const K& GetKey(ArraySize index) const;
+
+		/*
+		Gets the value at the given position in sorted order.
+
+		@param index - Position of the entry, less than Length().
+
+		@return Reference to the value.
+		*/
+		V& GetValue(ArraySize index);
+		const V& GetValue(ArraySize index) const;
+
+		/*
+		Gets the current number of entries in this FlatMap.
+
+		@return ArraySize containing the number of entries.
+		*/
+		ArraySize Length() const;
+
+		FlatMap(const FlatMap&) = delete;
+		FlatMap<K, V, Compare>& operator=(const FlatMap&) = delete;
+
+	private:
+		/*
+		Finds the sorted position of the given key.
+
+		@param key - The key to search for.
+
+		@return Index of the first key not before the given key.
+		*/
+		ArraySize FindIndex(const K& key) const;
+
+		/*
+		Returns whether the key at the given index is equal to the given key.
+
+		@param index - Result of FindIndex() for the key.
+
+		@param key - The key that was searched for.
+
+		@return Whether the key was found at the index.
+		*/
+		bool IsMatch(ArraySize index, const K& key) const;
+
+	private:
+		Vector<K> m_Keys; // Sorted keys.
+		Vector<V> m_Values; // Values in the same order as m_Keys.
+		Compare m_Compare; // Orders the keys.
+		bool m_IsSorted; // False while AddUnsorted() pairs are waiting on Build().
+	};
+
+	template <class K, class V, class Compare>
+	FlatMap<K, V, Compare>::FlatMap(ArraySize capacity) :
+		m_Keys(capacity, IsTriviallyRelocatable<K>::value),
+		m_Values(capacity, IsTriviallyRelocatable<V>::value),
+		m_Compare(),
+		m_IsSorted(true)
+	{
+	}
+
+	template <class K, class V, class Compare>
+	FlatMap<K, V, Compare>::FlatMap(FlatMap&& otherMap) :
+		m_Keys(std::move(otherMap.m_Keys)),
+		m_Values(std::move(otherMap.m_Values)),
+		m_Compare(otherMap.m_Compare),
+		m_IsSorted(otherMap.m_IsSorted)
+	{
+		otherMap.m_IsSorted = true;
+	}
+
+	template <class K, class V, class Compare>
+	FlatMap<K, V, Compare>& FlatMap<K, V, Compare>::operator=(FlatMap&& otherMap)
+	{
+		m_Keys = std::move(otherMap.m_Keys);
+		m_Values = std::move(otherMap.m_Values);
+		m_Compare = otherMap.m_Compare;
+		m_IsSorted = otherMap.m_IsSorted;
+		otherMap.m_IsSorted = true;
+
+		return *this;
+	}
+
+	template <class K, class V, class Compare>
+	V& FlatMap<K, V, Compare>::operator[](const K& key)
+	{
+		ArraySize index = FindIndex(key);
+		if (!IsMatch(index, key))
+		{
+			m_Keys.Insert(index, key);
+			m_Values.Insert(index, V());
+		}
+
+		return m_Values[index];
+	}
+
+	template <class K, class V, class Compare>
+	bool FlatMap<K, V, Compare>::Insert(const K& key, const V& value)
+	{
+		ArraySize index = FindIndex(key);
+		if (IsMatch(index, key))
+		{
+			return false;
+		}
+
+		m_Keys.Insert(index, key);
+		m_Values.Insert(index, value);
+		return true;
+	}
+
+	template <class K, class V, class Compare>
+	bool FlatMap<K, V, Compare>::Insert(K&& key, V&& value)
+	{
+		ArraySize index = FindIndex(key);
+		if (IsMatch(index, key))
+		{
+			return false;
+		}
+
+		m_Keys.Insert(index, std::move(key));
+		m_Values.Insert(index, std::move(value));
+		return true;
+	}
+
+	template <class K, class V, class Compare>
+	void FlatMap<K, V, Compare>::AddUnsorted(const K& key, const V& value)
+	{
+		m_Keys.Push(key);
+		m_Values.Push(value);
+		m_IsSorted = false;
+	}
+
+	template <class K, class V, class Compare>
+	void FlatMap<K, V, Compare>::AddUnsorted(K&& key, V&& value)
+	{
+		m_Keys.Push(std::move(key));
+		m_Values.Push(std::move(value));
+		m_IsSorted = false;
+	}
+
+	template <class K, class V, class Compare>
+	void FlatMap<K, V, Compare>::Build()
+	{
+		if (m_IsSorted)
+		{
+			return;
+		}
+
+		/*
+		Sort an index array rather than the pairs themselves, then move each
+		pair into place once. The sort is stable, so the last of a run of
+		equal keys is the last one added.
+		*/
+		ArraySize length = m_Keys.Length();
+		Vector<UInt32> order(length);
+		for (UInt32 i = 0; i < length; ++i)
+		{
+			order.Push(i);
+		}
+
+		const K* keys = &m_Keys[0];
+		Compare compare = m_Compare;
+		MergeSort(order, [keys, compare](UInt32 a, UInt32 b) {
+			return compare(keys[a], keys[b]);
+		});
+
+		Vector<K> sortedKeys(length, IsTriviallyRelocatable<K>::value);
+		Vector<V> sortedValues(length, IsTriviallyRelocatable<V>::value);
+		for (ArraySize i = 0; i < length; ++i)
+		{
+			if (i + 1 < length && !compare(keys[order[i]], keys[order[i + 1]]))
+			{
+				continue;
+			}
+
+			sortedKeys.Push(std::move(m_Keys[order[i]]));
+			sortedValues.Push(std::move(m_Values[order[i]]));
+		}
+
+		m_Keys = std::move(sortedKeys);
+		m_Values = std::move(sortedValues);
+		m_IsSorted = true;
+	}
+
+	template <class K, class V, class Compare>
+	V* FlatMap<K, V, Compare>::Find(const K& key)
+	{
+		ArraySize index = FindIndex(key);
+		return IsMatch(index, key) ? &(m_Values[index]) : nullptr;
+	}
+
+	template <class K, class V, class Compare>
+	const V* FlatMap<K, V, Compare>::Find(const K& key) const
+	{
+		ArraySize index = FindIndex(key);
+		return IsMatch(index, key) ? &(m_Values[index]) : nullptr;
+	}
+
+	template <class K, class V, class Compare>
+	bool FlatMap<K, V, Compare>::Contains(const K& key) const
+	{
+		return IsMatch(FindIndex(key), key);
+	}
+
+	template <class K, class V, class Compare>
+	bool FlatMap<K, V, Compare>::Remove(const K& key)
+	{
+		ArraySize index = FindIndex(key);
+		if (!IsMatch(index, key))
+		{
+			return false;
+		}
+
+		m_Keys.Remove(index);
+		m_Values.Remove(index);
+		return true;
+	}
+
+	template <class K, class V, class Compare>
+	void FlatMap<K, V, Compare>::Clear()
+	{
+		m_Keys.Clear();
+		m_Values.Clear();
+		m_IsSorted = true;
+	}
+
+	template <class K, class V, class Compare>
+	void FlatMap<K, V, Compare>::Reserve(ArraySize capacity)
+	{
+		m_Keys.Reserve(capacity);
+		m_Values.Reserve(capacity);
+	}
+
+	template <class K, class V, class Compare>
+	template <class Function>
+	void FlatMap<K, V, Compare>::ForEach(Function function)
+	{
+		Assert(m_IsSorted);
+
+		for (ArraySize i = 0; i < m_Keys.Length(); ++i)
+		{
+			function((const K&)m_Keys[i], m_Values[i]);
+		}
+	}
+
+	template <class K, class V, class Compare>
+	const K& FlatMap<K, V, Compare>::GetKey(ArraySize index) const
+	{
+		return m_Keys[index];
+	}
+
+	template <class K, class V, class Compare>
+	V& FlatMap<K, V, Compare>::GetValue(ArraySize index)
+	{
+		return m_Values[index];
+	}
+
+	template <class K, class V, class Compare>
+	const V& FlatMap<K, V, Compare>::GetValue(ArraySize index) const
+	{
+		return m_Values[index];
+	}
+
+	template <class K, class V, class Compare>
+	ArraySize FlatMap<K, V, Compare>::Length() const
+	{
+		return m_Keys.Length();
+	}
+
+	template <class K, class V, class Compare>
+	ArraySize FlatMap<K, V, Compare>::FindIndex(const K& key) const
+	{
+		Assert(m_IsSorted);
+
+		ArraySize length = m_Keys.Length();
+		return length == 0 ? 0 : LowerBound(&m_Keys[0], length, key, m_Compare);
+	}
+
+	template <class K, class V, class Compare>
+	bool FlatMap<K, V, Compare>::IsMatch(ArraySize index, const K& key) const
+	{
+		return index < m_Keys.Length() && !m_Compare(key, m_Keys[index]);
+	}
+
+	template <class K, class V, class Compare>
+	struct IsTriviallyRelocatable<FlatMap<K, V, Compare>> : std::true_type {};
+}
\ No newline at end of file
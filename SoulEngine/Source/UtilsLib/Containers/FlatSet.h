@@ -0,0 +1,310 @@
+/*
+A set that keeps its keys sorted in one contiguous array.
+@file FlatSet.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <utility>
+
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Sort.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	The set counterpart of FlatMap: sorted keys in one Vector, searched with
+	a branchless binary search. Fill large sets with AddUnsorted() followed
+	by a single Build().
+	*/
+	template <class K, class Compare = Less>
+	class FlatSet
+	{
+	public:
+		/*
+		@param capacity - Number of preallocated keys.
+		*/
+		FlatSet(ArraySize capacity = 16);
+		FlatSet(FlatSet&& otherSet);
+
+		FlatSet<K, Compare>& operator=(FlatSet&& otherSet);
+
+		/*
+		Gets the key at the given position in sorted order.
+
+		@param index - Position of the key, less than Length().
+
+		@return Reference to the key.
+		*/
+		const K& operator[](ArraySize index) const;
+
+		/*
+		Adds a key in sorted position if it isn't in this FlatSet yet.
+
+		@param key - The key to insert.
+
+		@return Whether the key was inserted.
+		*/
+		bool Insert(const K& key);
+
+		/*
+		Adds a key in sorted position if it isn't in this FlatSet yet.
+
+		@param key - The key to insert.
+
+		@return Whether the key was inserted.
+		*/
+		bool Insert(K&& key);
+
+		/*
+		Appends a key without keeping the keys sorted. Call Build() once every
+		key has been added.
+
+		@param key - The key to add.
+		*/
+		void AddUnsorted(const K& key);
+
+		/*
+		Appends a key without keeping the keys sorted. Call Build() once every
+		key has been added.
+
+		@param key - The key to add.
+		*/
+		void AddUnsorted(K&& key);
+
+		/*
+		Sorts the keys added with AddUnsorted() and drops duplicates.
+		*/
+		void Build();
+
+		/*
+		Returns whether the given key is in this FlatSet.
+
+		@param key - The key to look up.
+
+		@return Whether the key is present.
+		*/
+		bool Contains(const K& key) const;
+
+		/*
+		Removes the given key.
+
+		@param key - The key to remove.
+
+		@return Whether the key was present.
+		*/
+		bool Remove(const K& key);
+
+		/*
+		Removes every key from this FlatSet.
+		*/
+		void Clear();
+
+		/*
+		Preallocates room for the given number of keys.
+
+		@param capacity - The number of keys to make room for.
+		*/
+		void Reserve(ArraySize capacity);
+
+		/*
+		Gets the current number of keys in this FlatSet.
+
+		@return ArraySize containing the number of keys.
+		*/
+		ArraySize Length() const;
+
+		FlatSet(const FlatSet&) = delete;
+		FlatSet<K, Compare>& operator=(const FlatSet&) = delete;
+
+	private:
+		/*
+		Finds the sorted position of the given key.
+
+		@param key - The key to search for.
+
+		@return Index of the first key not before the given key.
+		*/
+		ArraySize FindIndex(const K& key) const;
+
+		/*
+		Returns whether the key at the given index is equal to the given key.
+
+		@param index - Result of FindIndex() for the key.
+
+		@param key - The key that was searched for.
+
+		@return Whether the key was found at the index.
+		*/
+		bool IsMatch(ArraySize index, const K& key) const;
+
+	private:
+		Vector<K> m_Keys; // Sorted keys.
+		Compare m_Compare; // Orders the keys.
+		bool m_IsSorted; // False while AddUnsorted() keys are waiting on Build().
+	};
+
+	template <class K, class Compare>
+	FlatSet<K, Compare>::FlatSet(ArraySize capacity) :
+		m_Keys(capacity, IsTriviallyRelocatable<K>::value),
+		m_Compare(),
+		m_IsSorted(true)
+	{
+	}
+
+	template <class K, class Compare>
+	FlatSet<K, Compare>::FlatSet(FlatSet&& otherSet) :
+		m_Keys(std::move(otherSet.m_Keys)),
+		m_Compare(otherSet.m_Compare),
+		m_IsSorted(otherSet.m_IsSorted)
+	{
+		otherSet.m_IsSorted = true;
+	}
+
+	template <class K, class Compare>
+	FlatSet<K, Compare>& FlatSet<K, Compare>::operator=(FlatSet&& otherSet)
+	{
+		m_Keys = std::move(otherSet.m_Keys);
+		m_Compare = otherSet.m_Compare;
+		m_IsSorted = otherSet.m_IsSorted;
+		otherSet.m_IsSorted = true;
+
+		return *this;
+	}
+
+	template <class K, class Compare>
+	const K& FlatSet<K, Compare>::operator[](ArraySize index) const
+	{
+		return m_Keys[index];
+	}
+
+	template <class K, class Compare>
+	bool FlatSet<K, Compare>::Insert(const K& key)
+	{
+		ArraySize index = FindIndex(key);
+		if (IsMatch(index, key))
+		{
+			return false;
+		}
+
+		m_Keys.Insert(index, key);
+		return true;
+	}
+
+	template <class K, class Compare>
+	bool FlatSet<K, Compare>::Insert(K&& key)
+	{
+		ArraySize index = FindIndex(key);
+		if (IsMatch(index, key))
+		{
+			return false;
+		}
+
+		m_Keys.Insert(index, std::move(key));
+		return true;
+	}
+
+	template <class K, class Compare>
+	void FlatSet<K, Compare>::AddUnsorted(const K& key)
+	{
+		m_Keys.Push(key);
+		m_IsSorted = false;
+	}
+
+	template <class K, class Compare>
+	void FlatSet<K, Compare>::AddUnsorted(K&& key)
+	{
+		m_Keys.Push(std::move(key));
+		m_IsSorted = false;
+	}
+
+	template <class K, class Compare>
+	void FlatSet<K, Compare>::Build()
+	{
+		if (m_IsSorted)
+		{
+			return;
+		}
+
+		MergeSort(m_Keys, m_Compare);
+
+		// Compact runs of equal keys down to their first key.
+		ArraySize length = m_Keys.Length();
+		ArraySize uniqueCount = 1;
+		for (ArraySize i = 1; i < length; ++i)
+		{
+			if (m_Compare(m_Keys[uniqueCount - 1], m_Keys[i]))
+			{
+				if (uniqueCount != i)
+				{
+					m_Keys[uniqueCount] = std::move(m_Keys[i]);
+				}
+				++uniqueCount;
+			}
+		}
+
+		m_Keys.RemoveRange(uniqueCount, length - uniqueCount);
+		m_IsSorted = true;
+	}
+
+	template <class K, class Compare>
+	bool FlatSet<K, Compare>::Contains(const K& key) const
+	{
+		return IsMatch(FindIndex(key), key);
+	}
+
+	template <class K, class Compare>
+	bool FlatSet<K, Compare>::Remove(const K& key)
+	{
+		ArraySize index = FindIndex(key);
+		if (!IsMatch(index, key))
+		{
+			return false;
+		}
+
+		m_Keys.Remove(index);
+		return true;
+	}
+
+	template <class K, class Compare>
+	void FlatSet<K, Compare>::Clear()
+	{
+		m_Keys.Clear();
+		m_IsSorted = true;
+	}
+
+	template <class K, class Compare>
+	void FlatSet<K, Compare>::Reserve(ArraySize capacity)
+	{
+		m_Keys.Reserve(capacity);
+	}
+
+	template <class K, class Compare>
+	ArraySize FlatSet<K, Compare>::Length() const
+	{
+		return m_Keys.Length();
+	}
+
+	template <class K, class Compare>
+	ArraySize FlatSet<K, Compare>::FindIndex(const K& key) const
+	{
+		Assert(m_IsSorted);
+
+		ArraySize length = m_Keys.Length();
+		return length == 0 ? 0 : LowerBound(&m_Keys[0], length, key, m_Compare);
+	}
+
+	template <class K, class Compare>
+	bool FlatSet<K, Compare>::IsMatch(ArraySize index, const K& key) const
+	{
+		return index < m_Keys.Length() && !m_Compare(key, m_Keys[index]);
+	}
+
+	template <class K, class Compare>
+	struct IsTriviallyRelocatable<FlatSet<K, Compare>> : std::true_type {};
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+/*
+A self-resizing array that lives entirely in the MemoryManager's volatile
+arena.
+@file FrameVector.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+
+namespace Soul
+{
+	/*
+	A self-resizing array that lives entirely in the MemoryManager's volatile
+	arena. Growing the FrameVector extends its block in place when it is the
+	most recent volatile allocation, and otherwise bump allocates a new one.
+	Nothing is ever freed; the memory is reclaimed when the volatile arena is
+	cleared.
+
+	A FrameVector is only valid during the frame it was created in, and must
+	not be used after MemoryManager::IncrementFrameCounter() has been called.
+	*/
+	template <class T>
+	class FrameVector
+	{
+		static_assert(std::is_trivially_destructible<T>::value,
+			"FrameVector elements are never destructed.");
+
+	public:
+		/*
+		@param capacity - Number of preallocated data slots.
+		*/
+		FrameVector(ArraySize capacity = 16);
+		FrameVector(FrameVector&& otherVector);
+
+		FrameVector<T>& operator=(FrameVector&& otherVector);
+		T& operator[](ArraySize index);
+		const T& operator[](ArraySize index) const;
+
+		/*
+		Adds a new element to the end of this FrameVector.
+
+		@param element - The element to add to this FrameVector.
+		*/
+		void Push(const T& element);
+
+		/*
+		Adds a new element to the end of this FrameVector.
+
+		@param element - The element to add to this FrameVector.
+		*/
+		void Push(T&& element);
+
+		/*
+		Removes and returns the element at the end of this FrameVector.
+
+		@return Element at the end of the FrameVector.
+		*/
+		T Pop();
+
+		/*
+		Gets the current number of elements in this FrameVector.
+
+		@return ArraySize containing the number of elements in this FrameVector.
+		*/
+		ArraySize Length() const;
+
+		/*
+		Returns whether this FrameVector's memory is still alive, meaning the
+		frame it was created in has not ended yet.
+
+		@return Whether this FrameVector can still be used.
+		*/
+		bool IsValid() const;
+
+		FrameVector(const FrameVector&) = delete;
+		FrameVector<T>& operator=(const FrameVector&) = delete;
+
+	private:
+		/*
+		Doubles the capacity of this FrameVector.
+		*/
+		void Resize();
+
+	private:
+		T* m_Elements;
+		ArraySize m_Capacity;
+		ArraySize m_Length;
+		UInt64 m_FrameIndex; // Frame this FrameVector was allocated in.
+	};
+
+	template <class T>
+	FrameVector<T>::FrameVector(ArraySize capacity) :
+		m_Elements(MemoryManager::AllocateVolatile<T>(capacity)),
+		m_Capacity(capacity),
+		m_Length(0),
+		m_FrameIndex(MemoryManager::GetFrameIndex())
+	{
+	}
+
+	template <class T>
+	FrameVector<T>::FrameVector(FrameVector&& otherVector) :
+		m_Elements(otherVector.m_Elements),
+		m_Capacity(otherVector.m_Capacity),
+		m_Length(otherVector.m_Length),
+		m_FrameIndex(otherVector.m_FrameIndex)
+	{
+		otherVector.m_Elements = nullptr;
+		otherVector.m_Capacity = 0;
+		otherVector.m_Length = 0;
+	}
+
+	template <class T>
+	FrameVector<T>& FrameVector<T>::operator=(FrameVector&& otherVector)
+	{
+		m_Elements = otherVector.m_Elements;
+		m_Capacity = otherVector.m_Capacity;
+		m_Length = otherVector.m_Length;
+		m_FrameIndex = otherVector.m_FrameIndex;
+		otherVector.m_Elements = nullptr;
+		otherVector.m_Capacity = 0;
+		otherVector.m_Length = 0;
+
+		return *this;
+	}
+
+	template <class T>
+	T& FrameVector<T>::operator[](ArraySize index)
+	{
+		Assert(IsValid());
+		Assert(index < m_Length);
+		return m_Elements[index];
+	}
+
+	template <class T>
+	const T& FrameVector<T>::operator[](ArraySize index) const
+	{
+		Assert(IsValid());
+		Assert(index < m_Length);
+		return m_Elements[index];
+	}
+
+	template <class T>
+	void FrameVector<T>::Push(const T& element)
+	{
+		Assert(IsValid());
+
+		if (m_Length == m_Capacity)
+		{
+			Resize();
+		}
+
+		new (m_Elements + m_Length++) T(element);
+	}
+
+	template <class T>
+	void FrameVector<T>::Push(T&& element)
+	{
+		Assert(IsValid());
+
+		if (m_Length == m_Capacity)
+		{
+			Resize();
+		}
+
+		new (m_Elements + m_Length++) T(std::move(element));
+	}
+
+	template <class T>
+	T FrameVector<T>::Pop()
+	{
+		Assert(IsValid());
+		Assert(m_Length > 0);
+
+		return std::move(m_Elements[--m_Length]);
+	}
+
+	template <class T>
+	ArraySize FrameVector<T>::Length() const
+	{
+		return m_Length;
+	}
+
+	template <class T>
+	bool FrameVector<T>::IsValid() const
+	{
+		return m_FrameIndex == MemoryManager::GetFrameIndex();
+	}
+
+	template <class T>
+	void FrameVector<T>::Resize()
+	{
+		ArraySize newCapacity = m_Capacity * 2 + 1;
+
+		/*
+		If nothing was allocated after us we can simply bump the arena.
+		*/
+		if (MemoryManager::ExtendVolatile<T>(m_Elements, m_Capacity, newCapacity))
+		{
+			m_Capacity = newCapacity;
+			return;
+		}
+
+		T* newMemory = MemoryManager::AllocateVolatile<T>(newCapacity);
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			memcpy(newMemory, m_Elements, sizeof(T) * m_Length);
+		}
+		else
+		{
+			for (ArraySize i = 0; i < m_Length; ++i)
+			{
+				new (newMemory + i) T(std::move(m_Elements[i]));
+			}
+		}
+
+		m_Elements = newMemory;
+		m_Capacity = newCapacity;
+	}
+}
\ No newline at end of file
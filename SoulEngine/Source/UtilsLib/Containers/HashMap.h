@@ -0,0 +1,637 @@
+/*
+An open-addressing hash table that maps unique keys to values.
+@file HashMap.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <cstring>
+#include <emmintrin.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Hash.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Maths/Functions.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	An open-addressing hash table that maps unique keys to values. Alongside
+	the slot array the HashMap keeps one control byte per slot, holding either
+	7 bits of the key's hash or an empty/deleted marker. Lookups compare a
+	whole group of 16 control bytes against the hash with a single SSE2
+	instruction, and only touch the slots whose control byte matched.
+
+	The capacity is always a power of two and the table grows once it is 7/8
+	full. Keys need an equality operator and a Hash specialization.
+	*/
+	template <class K, class V, class Hasher = Hash<K>>
+	class HashMap
+	{
+	public:
+		/*
+		@param capacity - Number of preallocated slots. Rounded up to a power
+		                  of two, and at least 16.
+		*/
+		HashMap(ArraySize capacity = 16);
+		HashMap(HashMap&& otherMap);
+
+		HashMap& operator=(HashMap&& otherMap);
+
+		/*
+		Returns the value mapped to the given key, inserting a default
+		constructed value first if the key isn't in this HashMap.
+
+		@param key - The key whose value to get.
+
+		@return Reference to the value mapped to the key.
+		*/
+		V& operator[](const K& key);
+
+		/*
+		Maps the given key to the given value, unless the key is already in
+		this HashMap.
+
+		@param key - The key to insert.
+
+		@param value - The value to map the key to.
+
+		@return Whether the key was inserted.
+		*/
+		bool Insert(const K& key, const V& value);
+
+		/*
+		Maps the given key to the given value, unless the key is already in
+		this HashMap.
+
+		@param key - The key to insert.
+
+		@param value - The value to map the key to.
+
+		@return Whether the key was inserted.
+		*/
+		bool Insert(K&& key, V&& value);
+
+		/*
+		Finds the value mapped to the given key.
+
+		@param key - The key to look up.
+
+		@return Pointer to the value, or nullptr if the key isn't in this
+		        HashMap.
+		*/
+		V* Find(const K& key);
+		const V* Find(const K& key) const;
+
+		/*
+		Returns whether the given key is in this HashMap.
+
+		@param key - The key to look up.
+
+		@return Whether the key is in this HashMap.
+		*/
+		bool Contains(const K& key) const;
+
+		/*
+		Removes the given key and its value from this HashMap.
+
+		@param key - The key to remove.
+
+		@return Whether the key was in this HashMap.
+		*/
+		bool Remove(const K& key);
+
+		/*
+		Removes every key from this HashMap without releasing its memory.
+		*/
+		void Clear();
+
+		/*
+		Makes sure this HashMap can hold at least the given number of keys
+		without having to grow.
+
+		@param count - The number of keys this HashMap should fit.
+		*/
+		void Reserve(ArraySize count);
+
+		/*
+		Calls the provided function with every key and value in this HashMap,
+		in no particular order. The HashMap must not be modified during the
+		call.
+
+		@param function - Callable taking (const K& key, V& value).
+		*/
+		template <class Function>
+		void ForEach(Function function);
+
+		/*
+		Gets the current number of keys in this HashMap.
+
+		@return ArraySize containing the number of keys in this HashMap.
+		*/
+		ArraySize Length() const;
+
+		/*
+		Gets the number of slots in this HashMap.
+
+		@return ArraySize containing the capacity of this HashMap.
+		*/
+		ArraySize Capacity() const;
+
+		HashMap(const HashMap&) = delete;
+		HashMap& operator=(const HashMap&) = delete;
+
+	private:
+		struct Slot
+		{
+			K key;
+			V value;
+		};
+
+		static constexpr Byte Empty = 0x80; // Control byte of a never used slot.
+		static constexpr Byte Deleted = 0xFE; // Control byte of a removed slot.
+		static constexpr ArraySize GroupWidth = 16; // Control bytes probed at once.
+
+		/*
+		Returns a bit mask with a bit set for every control byte in the group
+		that equals the given value.
+
+		@param group - Pointer to the first control byte of the group.
+
+		@param value - The control byte to look for.
+
+		@return UInt32 with one bit per matching control byte.
+		*/
+		static UInt32 MatchGroup(const Byte* group, Byte value);
+
+		/*
+		Returns a bit mask with a bit set for every control byte in the group
+		that is empty or deleted.
+
+		@param group - Pointer to the first control byte of the group.
+
+		@return UInt32 with one bit per free control byte.
+		*/
+		static UInt32 MatchFree(const Byte* group);
+
+		/*
+		Returns the number of keys this HashMap can hold at the given capacity
+		before it needs to grow.
+
+		@param capacity - The capacity to check.
+
+		@return ArraySize containing the maximum number of keys.
+		*/
+		static ArraySize MaxLoad(ArraySize capacity);
+
+		/*
+		Finds the slot holding the given key.
+
+		@param key - The key to look up.
+
+		@param hash - The hash of the key.
+
+		@return Index of the slot, or m_Capacity if the key isn't present.
+		*/
+		Index FindIndex(const K& key, UInt64 hash) const;
+
+		/*
+		Finds the first free slot along the given hash's probe sequence.
+
+		@param hash - The hash of the key being inserted.
+
+		@return Index of the free slot.
+		*/
+		Index FindFreeIndex(UInt64 hash) const;
+
+		/*
+		Sets the control byte for a slot, keeping the cloned bytes after the
+		end of the control array in sync so groups can wrap around.
+
+		@param index - The index of the slot.
+
+		@param control - The new control byte.
+		*/
+		void SetControl(Index index, Byte control);
+
+		/*
+		Finds the given key, constructing a new slot for it if it isn't
+		present.
+
+		@param key - The key to find or insert.
+
+		@param inserted - Receives whether a new slot was constructed.
+
+		@param args - Arguments forwarded to the value's constructor.
+
+		@return Reference to the value mapped to the key.
+		*/
+		template <class KeyArg, class... Args>
+		V& FindOrInsert(KeyArg&& key, bool& inserted, Args&&... args);
+
+		/*
+		Moves every key into a new table with the given capacity, dropping any
+		deleted markers.
+
+		@param capacity - The capacity of the new table.
+		*/
+		void Rehash(ArraySize capacity);
+
+		/*
+		Destructs the key and value in a slot and zeroes it.
+
+		@param slot - The slot to destroy.
+		*/
+		static void DestroySlot(Slot* slot);
+
+	private:
+		UniqueHandle<Byte> m_Control; // One control byte per slot, plus a cloned group.
+		UniqueHandle<Slot> m_Slots; // The key value pairs.
+		ArraySize m_Capacity; // Number of slots, always a power of two.
+		ArraySize m_Length; // Number of keys.
+		ArraySize m_GrowthLeft; // Empty slots that can be used before growing.
+	};
+
+	template <class K, class V, class Hasher>
+	HashMap<K, V, Hasher>::HashMap(ArraySize capacity) :
+		m_Capacity(0),
+		m_Length(0),
+		m_GrowthLeft(0)
+	{
+		Rehash(NextPowerOfTwo(capacity < GroupWidth ? GroupWidth : capacity));
+	}
+
+	template <class K, class V, class Hasher>
+	HashMap<K, V, Hasher>::HashMap(HashMap&& otherMap) :
+		m_Control(std::move(otherMap.m_Control)),
+		m_Slots(std::move(otherMap.m_Slots)),
+		m_Capacity(otherMap.m_Capacity),
+		m_Length(otherMap.m_Length),
+		m_GrowthLeft(otherMap.m_GrowthLeft)
+	{
+		otherMap.m_Capacity = 0;
+		otherMap.m_Length = 0;
+		otherMap.m_GrowthLeft = 0;
+	}
+
+	template <class K, class V, class Hasher>
+	HashMap<K, V, Hasher>& HashMap<K, V, Hasher>::operator=(HashMap&& otherMap)
+	{
+		m_Control = std::move(otherMap.m_Control);
+		m_Slots = std::move(otherMap.m_Slots);
+		m_Capacity = otherMap.m_Capacity;
+		m_Length = otherMap.m_Length;
+		m_GrowthLeft = otherMap.m_GrowthLeft;
+		otherMap.m_Capacity = 0;
+		otherMap.m_Length = 0;
+		otherMap.m_GrowthLeft = 0;
+
+		return *this;
+	}
+
+	template <class K, class V, class Hasher>
+	V& HashMap<K, V, Hasher>::operator[](const K& key)
+	{
+		bool inserted;
+		return FindOrInsert(key, inserted);
+	}
+
+	template <class K, class V, class Hasher>
+	bool HashMap<K, V, Hasher>::Insert(const K& key, const V& value)
+	{
+		bool inserted;
+		FindOrInsert(key, inserted, value);
+		return inserted;
+	}
+
+	template <class K, class V, class Hasher>
+	bool HashMap<K, V, Hasher>::Insert(K&& key, V&& value)
+	{
+		bool inserted;
+		FindOrInsert(std::move(key), inserted, std::move(value));
+		return inserted;
+	}
+
+	template <class K, class V, class Hasher>
+	V* HashMap<K, V, Hasher>::Find(const K& key)
+	{
+		Index index = FindIndex(key, Hasher()(key));
+		return index == m_Capacity ? nullptr : &(m_Slots[index].value);
+	}
+
+	template <class K, class V, class Hasher>
+	const V* HashMap<K, V, Hasher>::Find(const K& key) const
+	{
+		Index index = FindIndex(key, Hasher()(key));
+		return index == m_Capacity ? nullptr : &(m_Slots[index].value);
+	}
+
+	template <class K, class V, class Hasher>
+	bool HashMap<K, V, Hasher>::Contains(const K& key) const
+	{
+		return FindIndex(key, Hasher()(key)) != m_Capacity;
+	}
+
+	template <class K, class V, class Hasher>
+	bool HashMap<K, V, Hasher>::Remove(const K& key)
+	{
+		Index index = FindIndex(key, Hasher()(key));
+		if (index == m_Capacity)
+		{
+			return false;
+		}
+
+		/*
+		Leave a deleted marker rather than an empty one so probe sequences
+		running through this slot keep going.
+		*/
+		DestroySlot(m_Slots.GetMemory() + index);
+		SetControl(index, Deleted);
+		--m_Length;
+
+		return true;
+	}
+
+	template <class K, class V, class Hasher>
+	void HashMap<K, V, Hasher>::Clear()
+	{
+		if (m_Capacity == 0)
+		{
+			return;
+		}
+
+		Byte* control = m_Control.GetMemory();
+		Slot* slots = m_Slots.GetMemory();
+		for (Index i = 0; i < m_Capacity; ++i)
+		{
+			if (control[i] < Empty)
+			{
+				DestroySlot(slots + i);
+			}
+		}
+
+		memset(control, Empty, m_Capacity + GroupWidth);
+		m_Length = 0;
+		m_GrowthLeft = MaxLoad(m_Capacity);
+	}
+
+	template <class K, class V, class Hasher>
+	void HashMap<K, V, Hasher>::Reserve(ArraySize count)
+	{
+		ArraySize capacity = NextPowerOfTwo(count + count / 7 + 1);
+		if (capacity > m_Capacity)
+		{
+			Rehash(capacity);
+		}
+	}
+
+	template <class K, class V, class Hasher>
+	template <class Function>
+	void HashMap<K, V, Hasher>::ForEach(Function function)
+	{
+		if (m_Capacity == 0)
+		{
+			return;
+		}
+
+		Byte* control = m_Control.GetMemory();
+		Slot* slots = m_Slots.GetMemory();
+		for (Index i = 0; i < m_Capacity; ++i)
+		{
+			if (control[i] < Empty)
+			{
+				function((const K&)slots[i].key, slots[i].value);
+			}
+		}
+	}
+
+	template <class K, class V, class Hasher>
+	ArraySize HashMap<K, V, Hasher>::Length() const
+	{
+		return m_Length;
+	}
+
+	template <class K, class V, class Hasher>
+	ArraySize HashMap<K, V, Hasher>::Capacity() const
+	{
+		return m_Capacity;
+	}
+
+	template <class K, class V, class Hasher>
+	UInt32 HashMap<K, V, Hasher>::MatchGroup(const Byte* group, Byte value)
+	{
+		__m128i controls = _mm_loadu_si128((const __m128i*)group);
+		return (UInt32)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(controls, _mm_set1_epi8((char)value)));
+	}
+
+	template <class K, class V, class Hasher>
+	UInt32 HashMap<K, V, Hasher>::MatchFree(const Byte* group)
+	{
+		// Empty and deleted are the only control bytes with the high bit set.
+		return (UInt32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+	}
+
+	template <class K, class V, class Hasher>
+	ArraySize HashMap<K, V, Hasher>::MaxLoad(ArraySize capacity)
+	{
+		return capacity - capacity / 8;
+	}
+
+	template <class K, class V, class Hasher>
+	Index HashMap<K, V, Hasher>::FindIndex(const K& key, UInt64 hash) const
+	{
+		if (m_Length == 0)
+		{
+			return m_Capacity;
+		}
+
+		const Byte* control = m_Control.GetMemory();
+		const Slot* slots = m_Slots.GetMemory();
+		ArraySize mask = m_Capacity - 1;
+		Byte fingerprint = (Byte)(hash & 0x7F);
+		Index position = (Index)(hash >> 7) & mask;
+
+		/*
+		Probe group by group, stepping one group further each time. Any empty
+		control byte in a group means the key was never inserted past it.
+		*/
+		for (ArraySize step = GroupWidth; ; step += GroupWidth)
+		{
+			UInt32 matches = MatchGroup(control + position, fingerprint);
+			while (matches)
+			{
+				Index index = (position + CountTrailingZeros(matches)) & mask;
+				if (slots[index].key == key)
+				{
+					return index;
+				}
+				matches &= matches - 1;
+			}
+
+			if (MatchGroup(control + position, Empty))
+			{
+				return m_Capacity;
+			}
+
+			position = (position + step) & mask;
+		}
+	}
+
+	template <class K, class V, class Hasher>
+	Index HashMap<K, V, Hasher>::FindFreeIndex(UInt64 hash) const
+	{
+		const Byte* control = m_Control.GetMemory();
+		ArraySize mask = m_Capacity - 1;
+		Index position = (Index)(hash >> 7) & mask;
+
+		for (ArraySize step = GroupWidth; ; step += GroupWidth)
+		{
+			UInt32 free = MatchFree(control + position);
+			if (free)
+			{
+				return (position + CountTrailingZeros(free)) & mask;
+			}
+
+			position = (position + step) & mask;
+		}
+	}
+
+	template <class K, class V, class Hasher>
+	void HashMap<K, V, Hasher>::SetControl(Index index, Byte control)
+	{
+		Byte* controls = m_Control.GetMemory();
+		controls[index] = control;
+		if (index < GroupWidth)
+		{
+			controls[m_Capacity + index] = control;
+		}
+	}
+
+	template <class K, class V, class Hasher>
+	template <class KeyArg, class... Args>
+	V& HashMap<K, V, Hasher>::FindOrInsert(KeyArg&& key, bool& inserted,
+		Args&&... args)
+	{
+		UInt64 hash = Hasher()(key);
+		Index index = FindIndex(key, hash);
+		if (index != m_Capacity)
+		{
+			inserted = false;
+			return m_Slots[index].value;
+		}
+
+		/*
+		Out of empty slots. If deleted markers are what's filling the table up,
+		rebuilding at the same size is enough; otherwise double it.
+		*/
+		if (m_GrowthLeft == 0)
+		{
+			if (m_Capacity == 0)
+			{
+				Rehash(GroupWidth);
+			}
+			else
+			{
+				Rehash(m_Length < MaxLoad(m_Capacity) / 2 ? m_Capacity : m_Capacity * 2);
+			}
+		}
+
+		index = FindFreeIndex(hash);
+		if (m_Control[index] == Empty)
+		{
+			--m_GrowthLeft;
+		}
+		SetControl(index, (Byte)(hash & 0x7F));
+
+		Slot* slot = m_Slots.GetMemory() + index;
+		new (&(slot->key)) K(std::forward<KeyArg>(key));
+		new (&(slot->value)) V(std::forward<Args>(args)...);
+		++m_Length;
+
+		inserted = true;
+		return slot->value;
+	}
+
+	template <class K, class V, class Hasher>
+	void HashMap<K, V, Hasher>::Rehash(ArraySize capacity)
+	{
+		UniqueHandle<Byte> oldControl = std::move(m_Control);
+		UniqueHandle<Slot> oldSlots = std::move(m_Slots);
+		ArraySize oldCapacity = m_Capacity;
+
+		m_Control = MemoryManager::AllocateArray<Byte>(capacity + GroupWidth);
+		m_Slots = MemoryManager::AllocateArray<Slot>(capacity);
+		memset(m_Control.GetMemory(), Empty, capacity + GroupWidth);
+		m_Capacity = capacity;
+		m_GrowthLeft = MaxLoad(capacity) - m_Length;
+
+		/*
+		The defragmenter moves blocks with memcpy, which is only safe for
+		slots that can be relocated bitwise.
+		*/
+		constexpr bool isRelocatable = IsTriviallyRelocatable<K>::value &&
+			IsTriviallyRelocatable<V>::value;
+		if constexpr (!isRelocatable)
+		{
+			m_Slots.SetImmovable(true);
+		}
+
+		if (oldCapacity == 0)
+		{
+			return;
+		}
+
+		const Byte* control = oldControl.GetMemory();
+		Slot* slots = oldSlots.GetMemory();
+		Slot* newSlots = m_Slots.GetMemory();
+		for (Index i = 0; i < oldCapacity; ++i)
+		{
+			if (control[i] >= Empty)
+			{
+				continue;
+			}
+
+			UInt64 hash = Hasher()(slots[i].key);
+			Index index = FindFreeIndex(hash);
+			SetControl(index, (Byte)(hash & 0x7F));
+
+			if constexpr (isRelocatable)
+			{
+				memcpy(newSlots + index, slots + i, sizeof(Slot));
+			}
+			else
+			{
+				new (&(newSlots[index].key)) K(std::move(slots[i].key));
+				new (&(newSlots[index].value)) V(std::move(slots[i].value));
+			}
+		}
+
+		// The new slots own any deep data now.
+		if constexpr (isRelocatable && !std::is_trivially_copyable<Slot>::value)
+		{
+			memset(slots, 0, oldCapacity * sizeof(Slot));
+		}
+	}
+
+	template <class K, class V, class Hasher>
+	void HashMap<K, V, Hasher>::DestroySlot(Slot* slot)
+	{
+		slot->~Slot();
+		if constexpr (!std::is_trivially_copyable<Slot>::value)
+		{
+			memset(slot, 0, sizeof(Slot));
+		}
+	}
+
+	template <class K, class V, class Hasher>
+	struct IsTriviallyRelocatable<HashMap<K, V, Hasher>> : std::true_type {};
+}
\ No newline at end of file
@@ -0,0 +1,535 @@
+/*
+A d-ary heap that always hands out its highest priority element first.
+@file PriorityQueue.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <utility>
+
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Containers/SlotMap.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Sort.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	A priority queue stored as an implicit Arity-ary heap in a Vector. The
+	element that Compare says belongs before every other element comes out
+	first, so with the default Less the smallest element is popped first,
+	which is what timers and path searches want.
+
+	Every element gets a SlotKey when it is pushed, which can later be used
+	to change its priority (decrease-key) or remove it without searching the
+	heap. Wider heaps are shallower, trading more comparisons per level for
+	fewer cache misses; 4 is a good default.
+
+	To fill a large queue, AddUnsorted() every element and then call
+	Heapify() once, which builds the heap in linear time.
+	*/
+	template <class T, class Compare = Less, ArraySize Arity = 4>
+	class PriorityQueue
+	{
+		static_assert(Arity >= 2, "PriorityQueue needs at least two children per node.");
+
+	public:
+		/*
+		@param capacity - Number of preallocated elements.
+		*/
+		PriorityQueue(ArraySize capacity = 16);
+		PriorityQueue(PriorityQueue&& otherQueue);
+
+		PriorityQueue<T, Compare, Arity>& operator=(PriorityQueue&& otherQueue);
+
+		/*
+		Adds an element to this PriorityQueue.
+
+		@param element - The element to add.
+
+		@return SlotKey that identifies the element until it is popped or
+		        removed.
+		*/
+		SlotKey Push(const T& element);
+
+		/*
+		Adds an element to this PriorityQueue.
+
+		@param element - The element to add.
+
+		@return SlotKey that identifies the element until it is popped or
+		        removed.
+		*/
+		SlotKey Push(T&& element);
+
+		/*
+		Appends an element without restoring the heap order. Call Heapify()
+		once every element has been added.
+
+		@param element - The element to add.
+
+		@return SlotKey that identifies the element until it is popped or
+		        removed.
+		*/
+		SlotKey AddUnsorted(const T& element);
+
+		/*
+		Appends an element without restoring the heap order. Call Heapify()
+		once every element has been added.
+
+		@param element - The element to add.
+
+		@return SlotKey that identifies the element until it is popped or
+		        removed.
+		*/
+		SlotKey AddUnsorted(T&& element);
+
+		/*
+		Restores the heap order in linear time after AddUnsorted() calls.
+		*/
+		void Heapify();
+
+		/*
+		Gets the element that will be popped next.
+
+		@return Reference to the highest priority element.
+		*/
+		const T& Peek() const;
+
+		/*
+		Removes the highest priority element and returns it.
+
+		@return The element that used to be at the front of this
+		        PriorityQueue.
+		*/
+		T Pop();
+
+		/*
+		Replaces the element with the given key and moves it to its new place
+		in the heap. Raising the element's priority is the classic
+		decrease-key operation, but lowering it works too.
+
+		@param key - The key of the element to replace.
+
+		@param element - The new element.
+
+		@return Whether the key referred to an element.
+		*/
+		bool Update(SlotKey key, const T& element);
+
+		/*
+		Removes the element with the given key.
+
+		@param key - The key of the element to remove.
+
+		@return Whether the key referred to an element.
+		*/
+		bool Remove(SlotKey key);
+
+		/*
+		Finds the element with the given key.
+
+		@param key - The key of the element.
+
+		@return Pointer to the element, or nullptr if it has left the queue.
+		*/
+		const T* Find(SlotKey key) const;
+
+		/*
+		Returns whether the element with the given key is still queued.
+
+		@param key - The key of the element.
+
+		@return Whether the key refers to an element.
+		*/
+		bool Contains(SlotKey key) const;
+
+		/*
+		Removes every element from this PriorityQueue. Every key handed out so
+		far becomes invalid.
+		*/
+		void Clear();
+
+		/*
+		Gets the current number of elements in this PriorityQueue.
+
+		@return ArraySize containing the number of elements.
+		*/
+		ArraySize Length() const;
+
+		PriorityQueue(const PriorityQueue&) = delete;
+		PriorityQueue<T, Compare, Arity>& operator=(const PriorityQueue&) = delete;
+
+	private:
+		struct Entry
+		{
+			T element;
+			UInt32 slot; // Index of the slot tracking this entry's position.
+		};
+
+		struct Slot
+		{
+			UInt32 position; // Index in the heap, or the next free slot.
+			UInt32 generation; // Odd while the slot is in use.
+		};
+
+		/*
+		Claims a slot for an entry that is about to be pushed onto the heap.
+
+		@return Index of the claimed slot.
+		*/
+		UInt32 ClaimSlot();
+
+		/*
+		Returns a slot to the free list, invalidating its keys.
+
+		@param slotIndex - The slot to release.
+		*/
+		void ReleaseSlot(UInt32 slotIndex);
+
+		/*
+		Returns the heap position of the element with the given key.
+
+		@param key - The key to look up.
+
+		@return Heap position, or Length() if the key is stale.
+		*/
+		ArraySize GetPosition(SlotKey key) const;
+
+		/*
+		Moves the entry at the given position towards the root until its
+		parent belongs before it.
+
+		@param position - Heap position of the entry.
+		*/
+		void SiftUp(ArraySize position);
+
+		/*
+		Moves the entry at the given position towards the leaves until it
+		belongs before all of its children.
+
+		@param position - Heap position of the entry.
+		*/
+		void SiftDown(ArraySize position);
+
+		/*
+		Restores the heap order for an entry that has just been replaced.
+
+		@param position - Heap position of the replaced entry.
+		*/
+		void Restore(ArraySize position);
+
+	private:
+		static constexpr UInt32 NoFreeSlot = (UInt32)-1;
+
+		Vector<Entry> m_Heap; // Entries in heap order.
+		Vector<Slot> m_Slots; // Heap positions of the entries, by key.
+		UInt32 m_FreeSlot; // First slot in the free list.
+		Compare m_Compare; // Orders the elements.
+	};
+
+	template <class T, class Compare, ArraySize Arity>
+	PriorityQueue<T, Compare, Arity>::PriorityQueue(ArraySize capacity) :
+		m_Heap(capacity, IsTriviallyRelocatable<T>::value),
+		m_Slots(capacity),
+		m_FreeSlot(NoFreeSlot),
+		m_Compare()
+	{
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	PriorityQueue<T, Compare, Arity>::PriorityQueue(PriorityQueue&& otherQueue) :
+		m_Heap(std::move(otherQueue.m_Heap)),
+		m_Slots(std::move(otherQueue.m_Slots)),
+		m_FreeSlot(otherQueue.m_FreeSlot),
+		m_Compare(otherQueue.m_Compare)
+	{
+		otherQueue.m_FreeSlot = NoFreeSlot;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	PriorityQueue<T, Compare, Arity>& PriorityQueue<T, Compare, Arity>::operator=(PriorityQueue&& otherQueue)
+	{
+		m_Heap = std::move(otherQueue.m_Heap);
+		m_Slots = std::move(otherQueue.m_Slots);
+		m_FreeSlot = otherQueue.m_FreeSlot;
+		m_Compare = otherQueue.m_Compare;
+		otherQueue.m_FreeSlot = NoFreeSlot;
+
+		return *this;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	SlotKey PriorityQueue<T, Compare, Arity>::Push(const T& element)
+	{
+		SlotKey key = AddUnsorted(element);
+		SiftUp(m_Heap.Length() - 1);
+		return key;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	SlotKey PriorityQueue<T, Compare, Arity>::Push(T&& element)
+	{
+		SlotKey key = AddUnsorted(std::move(element));
+		SiftUp(m_Heap.Length() - 1);
+		return key;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	SlotKey PriorityQueue<T, Compare, Arity>::AddUnsorted(const T& element)
+	{
+		UInt32 slotIndex = ClaimSlot();
+		m_Heap.Push(Entry{ element, slotIndex });
+		return SlotKey{ slotIndex, m_Slots[slotIndex].generation };
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	SlotKey PriorityQueue<T, Compare, Arity>::AddUnsorted(T&& element)
+	{
+		UInt32 slotIndex = ClaimSlot();
+		m_Heap.Push(Entry{ std::move(element), slotIndex });
+		return SlotKey{ slotIndex, m_Slots[slotIndex].generation };
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	void PriorityQueue<T, Compare, Arity>::Heapify()
+	{
+		// Sift down every parent, starting from the last one.
+		ArraySize length = m_Heap.Length();
+		if (length < 2)
+		{
+			return;
+		}
+
+		for (ArraySize i = (length - 2) / Arity + 1; i > 0; --i)
+		{
+			SiftDown(i - 1);
+		}
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	const T& PriorityQueue<T, Compare, Arity>::Peek() const
+	{
+		Assert(m_Heap.Length() > 0);
+
+		return m_Heap[0].element;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	T PriorityQueue<T, Compare, Arity>::Pop()
+	{
+		Assert(m_Heap.Length() > 0);
+
+		ReleaseSlot(m_Heap[0].slot);
+
+		Entry last = m_Heap.Pop();
+		if (m_Heap.Length() == 0)
+		{
+			return std::move(last.element);
+		}
+
+		T element(std::move(m_Heap[0].element));
+		m_Heap[0] = std::move(last);
+		SiftDown(0);
+
+		return element;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	bool PriorityQueue<T, Compare, Arity>::Update(SlotKey key, const T& element)
+	{
+		ArraySize position = GetPosition(key);
+		if (position == m_Heap.Length())
+		{
+			return false;
+		}
+
+		m_Heap[position].element = element;
+		Restore(position);
+		return true;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	bool PriorityQueue<T, Compare, Arity>::Remove(SlotKey key)
+	{
+		ArraySize position = GetPosition(key);
+		if (position == m_Heap.Length())
+		{
+			return false;
+		}
+
+		ReleaseSlot(key.index);
+
+		Entry last = m_Heap.Pop();
+		if (position < m_Heap.Length())
+		{
+			m_Heap[position] = std::move(last);
+			Restore(position);
+		}
+
+		return true;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	const T* PriorityQueue<T, Compare, Arity>::Find(SlotKey key) const
+	{
+		ArraySize position = GetPosition(key);
+		return position == m_Heap.Length() ? nullptr : &(m_Heap[position].element);
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	bool PriorityQueue<T, Compare, Arity>::Contains(SlotKey key) const
+	{
+		return GetPosition(key) != m_Heap.Length();
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	void PriorityQueue<T, Compare, Arity>::Clear()
+	{
+		for (ArraySize i = 0; i < m_Heap.Length(); ++i)
+		{
+			ReleaseSlot(m_Heap[i].slot);
+		}
+
+		m_Heap.Clear();
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	ArraySize PriorityQueue<T, Compare, Arity>::Length() const
+	{
+		return m_Heap.Length();
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	UInt32 PriorityQueue<T, Compare, Arity>::ClaimSlot()
+	{
+		UInt32 slotIndex;
+		if (m_FreeSlot != NoFreeSlot)
+		{
+			slotIndex = m_FreeSlot;
+			m_FreeSlot = m_Slots[slotIndex].position;
+		}
+		else
+		{
+			slotIndex = (UInt32)m_Slots.Length();
+			m_Slots.Push(Slot{ 0, 0 });
+		}
+
+		Slot& slot = m_Slots[slotIndex];
+		++slot.generation;
+		slot.position = (UInt32)m_Heap.Length();
+
+		return slotIndex;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	void PriorityQueue<T, Compare, Arity>::ReleaseSlot(UInt32 slotIndex)
+	{
+		Slot& slot = m_Slots[slotIndex];
+		++slot.generation;
+		slot.position = m_FreeSlot;
+		m_FreeSlot = slotIndex;
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	ArraySize PriorityQueue<T, Compare, Arity>::GetPosition(SlotKey key) const
+	{
+		if (key.index >= m_Slots.Length())
+		{
+			return m_Heap.Length();
+		}
+
+		const Slot& slot = m_Slots[key.index];
+		return slot.generation == key.generation && (slot.generation & 1) ?
+			slot.position : m_Heap.Length();
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	void PriorityQueue<T, Compare, Arity>::SiftUp(ArraySize position)
+	{
+		/*
+		Lift the entry out and slide parents down into the hole, so each
+		level costs one move instead of a swap.
+		*/
+		Entry* heap = &m_Heap[0];
+		Slot* slots = &m_Slots[0];
+		Entry entry(std::move(heap[position]));
+
+		while (position > 0)
+		{
+			ArraySize parent = (position - 1) / Arity;
+			if (!m_Compare(entry.element, heap[parent].element))
+			{
+				break;
+			}
+
+			heap[position] = std::move(heap[parent]);
+			slots[heap[position].slot].position = (UInt32)position;
+			position = parent;
+		}
+
+		slots[entry.slot].position = (UInt32)position;
+		heap[position] = std::move(entry);
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	void PriorityQueue<T, Compare, Arity>::SiftDown(ArraySize position)
+	{
+		Entry* heap = &m_Heap[0];
+		Slot* slots = &m_Slots[0];
+		ArraySize length = m_Heap.Length();
+		Entry entry(std::move(heap[position]));
+
+		while (true)
+		{
+			ArraySize firstChild = position * Arity + 1;
+			if (firstChild >= length)
+			{
+				break;
+			}
+
+			ArraySize lastChild = firstChild + Arity < length ? firstChild + Arity : length;
+			ArraySize bestChild = firstChild;
+			for (ArraySize child = firstChild + 1; child < lastChild; ++child)
+			{
+				if (m_Compare(heap[child].element, heap[bestChild].element))
+				{
+					bestChild = child;
+				}
+			}
+
+			if (!m_Compare(heap[bestChild].element, entry.element))
+			{
+				break;
+			}
+
+			heap[position] = std::move(heap[bestChild]);
+			slots[heap[position].slot].position = (UInt32)position;
+			position = bestChild;
+		}
+
+		slots[entry.slot].position = (UInt32)position;
+		heap[position] = std::move(entry);
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	void PriorityQueue<T, Compare, Arity>::Restore(ArraySize position)
+	{
+		if (position > 0 &&
+			m_Compare(m_Heap[position].element, m_Heap[(position - 1) / Arity].element))
+		{
+			SiftUp(position);
+		}
+		else
+		{
+			SiftDown(position);
+		}
+	}
+
+	template <class T, class Compare, ArraySize Arity>
+	struct IsTriviallyRelocatable<PriorityQueue<T, Compare, Arity>> : std::true_type {};
+}
\ No newline at end of file
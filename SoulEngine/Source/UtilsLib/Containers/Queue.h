@@ -2,14 +2,22 @@
 FIFO container.
 @file Queue.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #pragma once
 
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 #include <Memory/MemoryManager.h>
 #include <Memory/UniqueHandle.h>
 #include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Maths/Functions.h>
+#include <UtilsLib/TypeTraits.h>
 
 namespace Soul
 {
@@ -18,23 +26,36 @@ namespace Soul
 	Push() and Peek() to manage the elements it contains. This is not a 
 	thread-safe container, for a thread-safe implementation, check
 	UtilsLib/Threads/ThreadSafeQueue.h.
+
+	The Queue is a ring buffer whose capacity is always a power of two, so
+	wrapping an index around the buffer is a single mask. A growable Queue
+	doubles its capacity when it fills up; a fixed Queue asserts instead.
 	*/
 	template <class T>
 	class Queue
 	{
 	public:
-		Queue(ArraySize capacity);
+		/*
+		@param capacity - Number of preallocated element slots. Rounded up to
+		                  the next power of two.
+
+		@param growable - Whether the Queue may grow when it is full.
+		*/
+		Queue(ArraySize capacity, bool growable = true);
 		Queue(Queue<T>&& otherQueue);
 
 		Queue<T>& operator=(Queue<T>&& otherQueue);
 
 		/*
-		Returns an immutable reference to the element at the front of this
-		queue.
+		Returns an immutable reference to the element the given distance from
+		the front of this queue.
+
+		@param index - How many elements from the front to look, where 0 is
+		               the front of the queue.
 
-		@return Reference to the first element in the queue.
+		@return Reference to the element at the given position in the queue.
 		*/
-		const T& Peek() const;
+		const T& Peek(ArraySize index = 0) const;
 
 		/*
 		Removes and returns the element at the front of the queue.
@@ -43,6 +64,16 @@ namespace Soul
 		*/
 		T Pop();
 
+		/*
+		Removes elements from the front of the queue, moving them into the
+		provided array in queue order.
+
+		@param elementsOut - Array of at least count elements to move into.
+
+		@param count - The number of elements to remove.
+		*/
+		void PopN(T* elementsOut, ArraySize count);
+
 		/*
 		Adds the provided element to the back of the queue.
 
@@ -57,6 +88,16 @@ namespace Soul
 		*/
 		void Push(T&& element);
 
+		/*
+		Copies an array of elements onto the back of the queue, growing it at
+		most once.
+
+		@param elements - Array of elements to add.
+
+		@param count - The number of elements in the array.
+		*/
+		void PushN(const T* elements, ArraySize count);
+
 		/*
 		Gets the maximum number of elements that can be stored in this queue.
 
@@ -75,21 +116,32 @@ namespace Soul
 		Queue(const Queue<T>&) = delete;
 		Queue<T>& operator=(const Queue<T>&) = delete;
 
+	private:
+		/*
+		Moves the elements into a new block of memory with at least the given
+		capacity, unwrapping them so the front of the queue is at index 0.
+
+		@param capacity - The minimum capacity of the new memory.
+		*/
+		void Grow(ArraySize capacity);
+
 	private:
 		UniqueHandle<T> m_Memory; // Handle to the memory block this queue uses.
 		Index m_Head; // The front of the queue.
-		Index m_Tail; // The element after the last element.
 		ArraySize m_Capacity; // The maximum number of elements in the queue.
+		ArraySize m_Mask; // m_Capacity - 1, used to wrap indices.
 		ArraySize m_Length; // The current number of elements in the queue.
+		bool m_IsGrowable; // Whether the queue grows when it's full.
 	};
 
 	template <class T>
-	Queue<T>::Queue(ArraySize capacity) :
-		m_Memory(MemoryManager::AllocateArray<T>(capacity)),
+	Queue<T>::Queue(ArraySize capacity, bool growable) :
+		m_Memory(MemoryManager::AllocateArray<T>(NextPowerOfTwo(capacity))),
 		m_Head(0),
-		m_Tail(0),
-		m_Capacity(capacity),
-		m_Length(0)
+		m_Capacity(NextPowerOfTwo(capacity)),
+		m_Mask(m_Capacity - 1),
+		m_Length(0),
+		m_IsGrowable(growable)
 	{
 
 	}
@@ -98,12 +150,14 @@ namespace Soul
 	Queue<T>::Queue(Queue<T>&& otherQueue) :
 		m_Memory(std::move(otherQueue.m_Memory)),
 		m_Head(otherQueue.m_Head),
-		m_Tail(otherQueue.m_Tail),
 		m_Capacity(otherQueue.m_Capacity),
-		m_Length(otherQueue.m_Length)
+		m_Mask(otherQueue.m_Mask),
+		m_Length(otherQueue.m_Length),
+		m_IsGrowable(otherQueue.m_IsGrowable)
 	{
 		otherQueue.m_Head = 0;
-		otherQueue.m_Tail = 0;
+		otherQueue.m_Capacity = 0;
+		otherQueue.m_Mask = 0;
 		otherQueue.m_Length = 0;
 	}
 
@@ -112,50 +166,141 @@ namespace Soul
 	{
 		m_Memory = std::move(otherQueue.m_Memory);
 		m_Head = otherQueue.m_Head;
-		m_Tail = otherQueue.m_Tail;
 		m_Capacity = otherQueue.m_Capacity;
+		m_Mask = otherQueue.m_Mask;
 		m_Length = otherQueue.m_Length;
+		m_IsGrowable = otherQueue.m_IsGrowable;
 
 		otherQueue.m_Head = 0;
-		otherQueue.m_Tail = 0;
+		otherQueue.m_Capacity = 0;
+		otherQueue.m_Mask = 0;
 		otherQueue.m_Length = 0;
 
 		return *this;
 	}
 
 	template <class T>
-	const T& Queue<T>::Peek() const
+	const T& Queue<T>::Peek(ArraySize index /*=0*/) const
 	{
-		Assert(m_Length > 0);
-		return m_Memory[m_Head];
+		Assert(index < m_Length);
+		return m_Memory[(m_Head + index) & m_Mask];
 	}
 
 	template <class T>
 	T Queue<T>::Pop()
 	{
 		Assert(m_Length > 0);
+
+		T* slot = m_Memory.GetMemory() + m_Head;
+		T element(std::move(*slot));
+
+		/*
+		Leave the slot zeroed like fresh memory so it can be constructed into
+		again.
+		*/
+		if constexpr (!std::is_trivially_copyable<T>::value)
+		{
+			slot->~T();
+			memset(slot, 0, sizeof(T));
+		}
+
+		m_Head = (m_Head + 1) & m_Mask;
 		--m_Length;
-		return std::move(m_Memory[m_Head++]);
+
+		return element;
+	}
+
+	template <class T>
+	void Queue<T>::PopN(T* elementsOut, ArraySize count)
+	{
+		Assert(count <= m_Length);
+
+		/*
+		The elements occupy at most two contiguous runs: from the head to the
+		end of the buffer, then from the start of the buffer.
+		*/
+		T* memory = m_Memory.GetMemory();
+		ArraySize firstRun = m_Capacity - m_Head;
+		if (firstRun > count)
+		{
+			firstRun = count;
+		}
+
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			memcpy(elementsOut, memory + m_Head, firstRun * sizeof(T));
+			memcpy(elementsOut + firstRun, memory, (count - firstRun) * sizeof(T));
+		}
+		else
+		{
+			for (ArraySize i = 0; i < count; ++i)
+			{
+				T* slot = memory + ((m_Head + i) & m_Mask);
+				elementsOut[i] = std::move(*slot);
+				slot->~T();
+				memset(slot, 0, sizeof(T));
+			}
+		}
+
+		m_Head = (m_Head + count) & m_Mask;
+		m_Length -= count;
 	}
 
 	template <class T>
 	void Queue<T>::Push(const T& element)
 	{
-		Assert(m_Length < m_Capacity);
+		if (m_Length == m_Capacity)
+		{
+			Grow(m_Capacity + 1);
+		}
 
-		m_Memory[m_Tail] = element;
+		new (m_Memory.GetMemory() + ((m_Head + m_Length) & m_Mask)) T(element);
 		++m_Length;
-		m_Tail = (m_Tail + 1) % m_Capacity;
 	}
 
 	template <class T>
 	void Queue<T>::Push(T&& element)
 	{
-		Assert(m_Length < m_Capacity);
+		if (m_Length == m_Capacity)
+		{
+			Grow(m_Capacity + 1);
+		}
 
-		m_Memory[m_Tail] = std::move(element);
+		new (m_Memory.GetMemory() + ((m_Head + m_Length) & m_Mask))
+			T(std::move(element));
 		++m_Length;
-		m_Tail = (m_Tail + 1) % m_Capacity;
+	}
+
+	template <class T>
+	void Queue<T>::PushN(const T* elements, ArraySize count)
+	{
+		if (m_Length + count > m_Capacity)
+		{
+			Grow(m_Length + count);
+		}
+
+		T* memory = m_Memory.GetMemory();
+		Index tail = (m_Head + m_Length) & m_Mask;
+		ArraySize firstRun = m_Capacity - tail;
+		if (firstRun > count)
+		{
+			firstRun = count;
+		}
+
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			memcpy(memory + tail, elements, firstRun * sizeof(T));
+			memcpy(memory, elements + firstRun, (count - firstRun) * sizeof(T));
+		}
+		else
+		{
+			for (ArraySize i = 0; i < count; ++i)
+			{
+				new (memory + ((tail + i) & m_Mask)) T(elements[i]);
+			}
+		}
+
+		m_Length += count;
 	}
 
 	template <class T>
@@ -169,4 +314,58 @@ namespace Soul
 	{
 		return m_Length;
 	}
+
+	template <class T>
+	void Queue<T>::Grow(ArraySize capacity)
+	{
+		Assert(m_IsGrowable);
+
+		ArraySize newCapacity = m_Capacity > 0 ? m_Capacity * 2 : 1;
+		if (newCapacity < capacity)
+		{
+			newCapacity = NextPowerOfTwo(capacity);
+		}
+
+		UniqueHandle<T> newMemory = MemoryManager::AllocateArray<T>(newCapacity);
+		if (m_Length > 0)
+		{
+			T* oldElements = m_Memory.GetMemory();
+			T* newElements = newMemory.GetMemory();
+
+			if constexpr (IsTriviallyRelocatable<T>::value)
+			{
+				ArraySize firstRun = m_Capacity - m_Head;
+				if (firstRun > m_Length)
+				{
+					firstRun = m_Length;
+				}
+
+				memcpy(newElements, oldElements + m_Head, firstRun * sizeof(T));
+				memcpy(newElements + firstRun, oldElements,
+					(m_Length - firstRun) * sizeof(T));
+
+				// The new memory owns any deep data now.
+				if constexpr (!std::is_trivially_copyable<T>::value)
+				{
+					memset(oldElements, 0, m_Capacity * sizeof(T));
+				}
+			}
+			else
+			{
+				for (ArraySize i = 0; i < m_Length; ++i)
+				{
+					new (newElements + i)
+						T(std::move(oldElements[(m_Head + i) & m_Mask]));
+				}
+			}
+		}
+
+		m_Memory = std::move(newMemory);
+		m_Head = 0;
+		m_Capacity = newCapacity;
+		m_Mask = newCapacity - 1;
+	}
+
+	template <class T>
+	struct IsTriviallyRelocatable<Queue<T>> : std::true_type {};
 }
\ No newline at end of file
@@ -0,0 +1,377 @@
+/*
+A container that hands out stable keys for its elements while keeping the
+elements densely packed.
+@file SlotMap.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <utility>
+
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	Identifies an element in a SlotMap. The generation is bumped every time a
+	slot is reused, so keys to removed elements never find the element that
+	replaced them. A zeroed SlotKey never refers to an element.
+	*/
+	struct SlotKey
+	{
+		UInt32 index; // Slot the element was placed in.
+		UInt32 generation; // Generation of the slot when the key was handed out.
+
+		bool operator==(const SlotKey& other) const
+		{
+			return index == other.index && generation == other.generation;
+		}
+
+		bool operator!=(const SlotKey& other) const
+		{
+			return !(*this == other);
+		}
+	};
+
+	/*
+	A container with O(1) insertion, removal and lookup through stable
+	SlotKeys. The elements themselves are kept densely packed in a Vector, so
+	iterating over them with operator[] and Length() touches no gaps. Removal
+	swaps the last element into the removed element's place, so element order
+	is not preserved.
+	*/
+	template <class T>
+	class SlotMap
+	{
+	public:
+		/*
+		@param capacity - Number of preallocated element slots.
+		*/
+		SlotMap(ArraySize capacity = 16);
+		SlotMap(SlotMap&& otherMap);
+
+		SlotMap<T>& operator=(SlotMap&& otherMap);
+
+		/*
+		Gets the element at the given dense index, for iterating over every
+		element. Dense indices change when elements are removed.
+
+		@param index - Dense index of the element, less than Length().
+
+		@return Reference to the element.
+		*/
+		T& operator[](ArraySize index);
+		const T& operator[](ArraySize index) const;
+
+		/*
+		Adds a new element to this SlotMap.
+
+		@param element - The element to add.
+
+		@return SlotKey that identifies the element until it is removed.
+		*/
+		SlotKey Insert(const T& element);
+
+		/*
+		Adds a new element to this SlotMap.
+
+		@param element - The element to add.
+
+		@return SlotKey that identifies the element until it is removed.
+		*/
+		SlotKey Insert(T&& element);
+
+		/*
+		Constructs a new element in place in this SlotMap.
+
+		@param args - Arguments forwarded to the element's constructor.
+
+		@return SlotKey that identifies the element until it is removed.
+		*/
+		template <class... Args>
+		SlotKey Emplace(Args&&... args);
+
+		/*
+		Finds the element with the given key.
+
+		@param key - The key of the element.
+
+		@return Pointer to the element, or nullptr if it has been removed.
+		*/
+		T* Find(SlotKey key);
+		const T* Find(SlotKey key) const;
+
+		/*
+		Returns whether the element with the given key is still in this
+		SlotMap.
+
+		@param key - The key of the element.
+
+		@return Whether the key refers to an element.
+		*/
+		bool Contains(SlotKey key) const;
+
+		/*
+		Removes the element with the given key by swapping the last element
+		into its place.
+
+		@param key - The key of the element to remove.
+
+		@return Whether the key referred to an element.
+		*/
+		bool Remove(SlotKey key);
+
+		/*
+		Removes every element from this SlotMap. Every key handed out so far
+		becomes invalid.
+		*/
+		void Clear();
+
+		/*
+		Gets the key of the element at the given dense index.
+
+		@param index - Dense index of the element, less than Length().
+
+		@return SlotKey of the element.
+		*/
+		SlotKey GetKey(ArraySize index) const;
+
+		/*
+		Gets the current number of elements in this SlotMap.
+
+		@return ArraySize containing the number of elements.
+		*/
+		ArraySize Length() const;
+
+		SlotMap(const SlotMap&) = delete;
+		SlotMap<T>& operator=(const SlotMap&) = delete;
+
+	private:
+		struct Slot
+		{
+			UInt32 denseIndex; // Index of the element, or the next free slot.
+			UInt32 generation; // Odd while the slot is in use.
+		};
+
+		/*
+		Claims a slot for an element that is about to be pushed onto the dense
+		array.
+
+		@return SlotKey for the claimed slot.
+		*/
+		SlotKey ClaimSlot();
+
+		/*
+		Returns the slot the key refers to, if the key is still valid.
+
+		@param key - The key to look up.
+
+		@return Pointer to the slot, or nullptr if the key is stale.
+		*/
+		const Slot* GetSlot(SlotKey key) const;
+
+	private:
+		static constexpr UInt32 NoFreeSlot = (UInt32)-1;
+
+		Vector<T> m_Elements; // Densely packed elements.
+		Vector<UInt32> m_ElementSlots; // Slot index of each dense element.
+		Vector<Slot> m_Slots; // Indirection from keys to dense indices.
+		UInt32 m_FreeSlot; // First slot in the free list.
+	};
+
+	template <class T>
+	SlotMap<T>::SlotMap(ArraySize capacity) :
+		m_Elements(capacity, IsTriviallyRelocatable<T>::value),
+		m_ElementSlots(capacity),
+		m_Slots(capacity),
+		m_FreeSlot(NoFreeSlot)
+	{
+	}
+
+	template <class T>
+	SlotMap<T>::SlotMap(SlotMap&& otherMap) :
+		m_Elements(std::move(otherMap.m_Elements)),
+		m_ElementSlots(std::move(otherMap.m_ElementSlots)),
+		m_Slots(std::move(otherMap.m_Slots)),
+		m_FreeSlot(otherMap.m_FreeSlot)
+	{
+		otherMap.m_FreeSlot = NoFreeSlot;
+	}
+
+	template <class T>
+	SlotMap<T>& SlotMap<T>::operator=(SlotMap&& otherMap)
+	{
+		m_Elements = std::move(otherMap.m_Elements);
+		m_ElementSlots = std::move(otherMap.m_ElementSlots);
+		m_Slots = std::move(otherMap.m_Slots);
+		m_FreeSlot = otherMap.m_FreeSlot;
+		otherMap.m_FreeSlot = NoFreeSlot;
+
+		return *this;
+	}
+
+	template <class T>
+	T& SlotMap<T>::operator[](ArraySize index)
+	{
+		return m_Elements[index];
+	}
+
+	template <class T>
+	const T& SlotMap<T>::operator[](ArraySize index) const
+	{
+		return m_Elements[index];
+	}
+
+	template <class T>
+	SlotKey SlotMap<T>::Insert(const T& element)
+	{
+		SlotKey key = ClaimSlot();
+		m_Elements.Push(element);
+		return key;
+	}
+
+	template <class T>
+	SlotKey SlotMap<T>::Insert(T&& element)
+	{
+		SlotKey key = ClaimSlot();
+		m_Elements.Push(std::move(element));
+		return key;
+	}
+
+	template <class T>
+	template <class... Args>
+	SlotKey SlotMap<T>::Emplace(Args&&... args)
+	{
+		SlotKey key = ClaimSlot();
+		m_Elements.EmplaceBack(std::forward<Args>(args)...);
+		return key;
+	}
+
+	template <class T>
+	T* SlotMap<T>::Find(SlotKey key)
+	{
+		const Slot* slot = GetSlot(key);
+		return slot ? &(m_Elements[slot->denseIndex]) : nullptr;
+	}
+
+	template <class T>
+	const T* SlotMap<T>::Find(SlotKey key) const
+	{
+		const Slot* slot = GetSlot(key);
+		return slot ? &(m_Elements[slot->denseIndex]) : nullptr;
+	}
+
+	template <class T>
+	bool SlotMap<T>::Contains(SlotKey key) const
+	{
+		return GetSlot(key) != nullptr;
+	}
+
+	template <class T>
+	bool SlotMap<T>::Remove(SlotKey key)
+	{
+		if (!GetSlot(key))
+		{
+			return false;
+		}
+
+		Slot& slot = m_Slots[key.index];
+		UInt32 denseIndex = slot.denseIndex;
+
+		/*
+		Swap the last element into the hole and point its slot at its new
+		home.
+		*/
+		m_Elements.SwapRemove(denseIndex);
+		m_ElementSlots.SwapRemove(denseIndex);
+		if (denseIndex < m_Elements.Length())
+		{
+			m_Slots[m_ElementSlots[denseIndex]].denseIndex = denseIndex;
+		}
+
+		++slot.generation;
+		slot.denseIndex = m_FreeSlot;
+		m_FreeSlot = key.index;
+
+		return true;
+	}
+
+	template <class T>
+	void SlotMap<T>::Clear()
+	{
+		for (ArraySize i = 0; i < m_ElementSlots.Length(); ++i)
+		{
+			UInt32 slotIndex = m_ElementSlots[i];
+			Slot& slot = m_Slots[slotIndex];
+			++slot.generation;
+			slot.denseIndex = m_FreeSlot;
+			m_FreeSlot = slotIndex;
+		}
+
+		m_Elements.Clear();
+		m_ElementSlots.Clear();
+	}
+
+	template <class T>
+	SlotKey SlotMap<T>::GetKey(ArraySize index) const
+	{
+		UInt32 slotIndex = m_ElementSlots[index];
+		return SlotKey{ slotIndex, m_Slots[slotIndex].generation };
+	}
+
+	template <class T>
+	ArraySize SlotMap<T>::Length() const
+	{
+		return m_Elements.Length();
+	}
+
+	template <class T>
+	SlotKey SlotMap<T>::ClaimSlot()
+	{
+		UInt32 denseIndex = (UInt32)m_Elements.Length();
+		UInt32 slotIndex;
+
+		if (m_FreeSlot != NoFreeSlot)
+		{
+			slotIndex = m_FreeSlot;
+			m_FreeSlot = m_Slots[slotIndex].denseIndex;
+		}
+		else
+		{
+			slotIndex = (UInt32)m_Slots.Length();
+			m_Slots.Push(Slot{ 0, 0 });
+		}
+
+		/*
+		Generations are odd while a slot is in use, so a zeroed key can never
+		match.
+		*/
+		Slot& slot = m_Slots[slotIndex];
+		++slot.generation;
+		slot.denseIndex = denseIndex;
+		m_ElementSlots.Push(slotIndex);
+
+		return SlotKey{ slotIndex, slot.generation };
+	}
+
+	template <class T>
+	const typename SlotMap<T>::Slot* SlotMap<T>::GetSlot(SlotKey key) const
+	{
+		if (key.index >= m_Slots.Length())
+		{
+			return nullptr;
+		}
+
+		const Slot& slot = m_Slots[key.index];
+		return slot.generation == key.generation && (slot.generation & 1) ?
+			&slot : nullptr;
+	}
+
+	template <class T>
+	struct IsTriviallyRelocatable<SlotMap<T>> : std::true_type {};
+}
\ No newline at end of file
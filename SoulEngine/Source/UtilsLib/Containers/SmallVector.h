@@ -0,0 +1,465 @@
+/*
+A self-resizing array that keeps its first few elements inline and only asks
+the MemoryManager for memory once it outgrows them.
+@file SmallVector.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	A self-resizing array with room for N elements stored inside the
+	SmallVector itself. Small lists never touch the MemoryManager; once more
+	than N elements are pushed the elements spill over to a handle in the
+	arena and the SmallVector behaves like a regular Vector from then on.
+
+	A zeroed SmallVector is a valid, empty SmallVector, so it can live in
+	memory handed out by MemoryManager::AllocateArray().
+	*/
+	template <class T, ArraySize N>
+	class SmallVector
+	{
+		static_assert(N > 0, "SmallVector needs at least one inline element.");
+
+	public:
+		SmallVector();
+		SmallVector(SmallVector&& otherVector);
+
+		~SmallVector();
+
+		SmallVector<T, N>& operator=(SmallVector&& otherVector);
+		T& operator[](ArraySize index);
+		const T& operator[](ArraySize index) const;
+
+		/*
+		Adds a new element to the end of this SmallVector.
+
+		@param element - The element to add to this SmallVector.
+		*/
+		void Push(const T& element);
+
+		/*
+		Adds a new element to the end of this SmallVector.
+
+		@param element - The element to add to this SmallVector.
+		*/
+		void Push(T&& element);
+
+		/*
+		Constructs a new element in place at the end of this SmallVector.
+
+		@param args - Arguments forwarded to the element's constructor.
+
+		@return Reference to the newly constructed element.
+		*/
+		template <class... Args>
+		T& EmplaceBack(Args&&... args);
+
+		/*
+		Removes and returns the element at the end of this SmallVector.
+
+		@return Element at the end of the SmallVector.
+		*/
+		T Pop();
+
+		/*
+		Removes the element at the given index, preserving element order.
+
+		@param index - The index of the element to be removed.
+		*/
+		void Remove(ArraySize index);
+
+		/*
+		Removes the element at the given index in constant time by moving the
+		last element into its place. Does not preserve element order.
+
+		@param index - The index of the element to be removed.
+		*/
+		void SwapRemove(ArraySize index);
+
+		/*
+		Removes every element from this SmallVector without releasing its
+		memory.
+		*/
+		void Clear();
+
+		/*
+		Makes sure this SmallVector can hold at least the given number of
+		elements without having to resize.
+
+		@param capacity - The number of elements this SmallVector should fit.
+		*/
+		void Reserve(ArraySize capacity);
+
+		/*
+		Gets the current number of elements in this SmallVector.
+
+		@return ArraySize containing the number of elements in this
+		        SmallVector.
+		*/
+		ArraySize Length() const;
+
+		/*
+		Gets the number of elements this SmallVector can hold before resizing.
+
+		@return ArraySize containing the capacity of this SmallVector.
+		*/
+		ArraySize Capacity() const;
+
+		/*
+		Returns whether the elements are still stored inside this SmallVector
+		rather than in the MemoryManager.
+
+		@return Whether this SmallVector is using its inline storage.
+		*/
+		bool IsInline() const;
+
+		SmallVector(const SmallVector&) = delete;
+		SmallVector<T, N>& operator=(const SmallVector&) = delete;
+
+	private:
+		/*
+		Returns a pointer to wherever the elements currently live.
+
+		@return Pointer to the first element.
+		*/
+		T* GetElements();
+		const T* GetElements() const;
+
+		/*
+		Moves the live elements into a new block of arena memory with the given
+		capacity.
+
+		@param capacity - The capacity of the new memory.
+		*/
+		void Reallocate(ArraySize capacity);
+
+		/*
+		Moves the live elements of another SmallVector's inline storage into
+		this SmallVector's inline storage.
+
+		@param otherVector - The SmallVector to take the elements from.
+		*/
+		void TakeInlineElements(SmallVector& otherVector);
+
+		/*
+		Destructs a run of elements and zeroes their slots.
+
+		@param index - The index of the first element to destroy.
+
+		@param count - The number of elements to destroy.
+		*/
+		void DestroyElements(ArraySize index, ArraySize count);
+
+	private:
+		UniqueHandle<T> m_Heap; // Spilled elements, if this SmallVector outgrew N.
+		ArraySize m_HeapCapacity; // Capacity of m_Heap.
+		ArraySize m_Length; // Number of live elements.
+		alignas(T) Byte m_Inline[N * sizeof(T)]; // Inline element storage.
+	};
+
+	template <class T, ArraySize N>
+	SmallVector<T, N>::SmallVector() :
+		m_HeapCapacity(0),
+		m_Length(0)
+	{
+	}
+
+	template <class T, ArraySize N>
+	SmallVector<T, N>::SmallVector(SmallVector&& otherVector) :
+		m_HeapCapacity(0),
+		m_Length(0)
+	{
+		if (otherVector.m_Heap.IsValid())
+		{
+			m_Heap = std::move(otherVector.m_Heap);
+			m_HeapCapacity = otherVector.m_HeapCapacity;
+			m_Length = otherVector.m_Length;
+			otherVector.m_HeapCapacity = 0;
+			otherVector.m_Length = 0;
+		}
+		else
+		{
+			TakeInlineElements(otherVector);
+		}
+	}
+
+	template <class T, ArraySize N>
+	SmallVector<T, N>::~SmallVector()
+	{
+		// Spilled elements are destructed along with the handle.
+		if (!m_Heap.IsValid())
+		{
+			DestroyElements(0, m_Length);
+		}
+	}
+
+	template <class T, ArraySize N>
+	SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& otherVector)
+	{
+		if (this == &otherVector)
+		{
+			return *this;
+		}
+
+		Clear();
+		m_Heap = UniqueHandle<T>();
+		m_HeapCapacity = 0;
+
+		if (otherVector.m_Heap.IsValid())
+		{
+			m_Heap = std::move(otherVector.m_Heap);
+			m_HeapCapacity = otherVector.m_HeapCapacity;
+			m_Length = otherVector.m_Length;
+			otherVector.m_HeapCapacity = 0;
+			otherVector.m_Length = 0;
+		}
+		else
+		{
+			TakeInlineElements(otherVector);
+		}
+
+		return *this;
+	}
+
+	template <class T, ArraySize N>
+	T& SmallVector<T, N>::operator[](ArraySize index)
+	{
+		Assert(index < m_Length);
+		return GetElements()[index];
+	}
+
+	template <class T, ArraySize N>
+	const T& SmallVector<T, N>::operator[](ArraySize index) const
+	{
+		Assert(index < m_Length);
+		return GetElements()[index];
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::Push(const T& element)
+	{
+		EmplaceBack(element);
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::Push(T&& element)
+	{
+		EmplaceBack(std::move(element));
+	}
+
+	template <class T, ArraySize N>
+	template <class... Args>
+	T& SmallVector<T, N>::EmplaceBack(Args&&... args)
+	{
+		if (m_Length == Capacity())
+		{
+			Reallocate(Capacity() * 2);
+		}
+
+		return *new (GetElements() + m_Length++) T(std::forward<Args>(args)...);
+	}
+
+	template <class T, ArraySize N>
+	T SmallVector<T, N>::Pop()
+	{
+		Assert(m_Length > 0);
+
+		T element(std::move(GetElements()[--m_Length]));
+		DestroyElements(m_Length, 1);
+
+		return element;
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::Remove(ArraySize index)
+	{
+		Assert(index < m_Length);
+
+		T* elements = GetElements();
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			elements[index].~T();
+			memmove(elements + index, elements + index + 1,
+				(m_Length - index - 1) * sizeof(T));
+			--m_Length;
+			if constexpr (!std::is_trivially_copyable<T>::value)
+			{
+				memset(elements + m_Length, 0, sizeof(T));
+			}
+		}
+		else
+		{
+			for (ArraySize i = index; i + 1 < m_Length; ++i)
+			{
+				elements[i] = std::move(elements[i + 1]);
+			}
+
+			--m_Length;
+			DestroyElements(m_Length, 1);
+		}
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::SwapRemove(ArraySize index)
+	{
+		Assert(index < m_Length);
+
+		T* elements = GetElements();
+		--m_Length;
+		if (index != m_Length)
+		{
+			elements[index] = std::move(elements[m_Length]);
+		}
+
+		DestroyElements(m_Length, 1);
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::Clear()
+	{
+		DestroyElements(0, m_Length);
+		m_Length = 0;
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::Reserve(ArraySize capacity)
+	{
+		if (capacity > Capacity())
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	template <class T, ArraySize N>
+	ArraySize SmallVector<T, N>::Length() const
+	{
+		return m_Length;
+	}
+
+	template <class T, ArraySize N>
+	ArraySize SmallVector<T, N>::Capacity() const
+	{
+		return m_Heap.IsValid() ? m_HeapCapacity : N;
+	}
+
+	template <class T, ArraySize N>
+	bool SmallVector<T, N>::IsInline() const
+	{
+		return !m_Heap.IsValid();
+	}
+
+	template <class T, ArraySize N>
+	T* SmallVector<T, N>::GetElements()
+	{
+		return m_Heap.IsValid() ? m_Heap.GetMemory() : (T*)m_Inline;
+	}
+
+	template <class T, ArraySize N>
+	const T* SmallVector<T, N>::GetElements() const
+	{
+		return m_Heap.IsValid() ? m_Heap.GetMemory() : (const T*)m_Inline;
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::Reallocate(ArraySize capacity)
+	{
+		UniqueHandle<T> newMemory = MemoryManager::AllocateArray<T>(capacity);
+
+		/*
+		The defragmenter moves blocks with memcpy, which is only safe for
+		elements that can be relocated bitwise.
+		*/
+		if constexpr (!IsTriviallyRelocatable<T>::value)
+		{
+			newMemory.SetImmovable(true);
+		}
+
+		T* elements = GetElements();
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			memcpy(newMemory.GetMemory(), elements, sizeof(T) * m_Length);
+			if constexpr (!std::is_trivially_copyable<T>::value)
+			{
+				memset(elements, 0, sizeof(T) * m_Length);
+			}
+		}
+		else
+		{
+			for (ArraySize i = 0; i < m_Length; ++i)
+			{
+				new (&(newMemory[i])) T(std::move(elements[i]));
+			}
+
+			// Elements left in the old heap are destructed along with it.
+			if (!m_Heap.IsValid())
+			{
+				DestroyElements(0, m_Length);
+			}
+		}
+
+		m_Heap = std::move(newMemory);
+		m_HeapCapacity = capacity;
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::TakeInlineElements(SmallVector& otherVector)
+	{
+		T* elements = (T*)m_Inline;
+		T* otherElements = (T*)otherVector.m_Inline;
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			memcpy(elements, otherElements, sizeof(T) * otherVector.m_Length);
+		}
+		else
+		{
+			for (ArraySize i = 0; i < otherVector.m_Length; ++i)
+			{
+				new (elements + i) T(std::move(otherElements[i]));
+			}
+			otherVector.DestroyElements(0, otherVector.m_Length);
+		}
+
+		m_Length = otherVector.m_Length;
+		otherVector.m_Length = 0;
+	}
+
+	template <class T, ArraySize N>
+	void SmallVector<T, N>::DestroyElements(ArraySize index, ArraySize count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		T* elements = GetElements();
+		if constexpr (!std::is_trivially_destructible<T>::value)
+		{
+			for (ArraySize i = index; i < index + count; ++i)
+			{
+				elements[i].~T();
+			}
+		}
+		if constexpr (!std::is_trivially_copyable<T>::value)
+		{
+			memset(elements + index, 0, count * sizeof(T));
+		}
+	}
+
+	template <class T, ArraySize N>
+	struct IsTriviallyRelocatable<SmallVector<T, N>> : IsTriviallyRelocatable<T> {};
+}
\ No newline at end of file
@@ -0,0 +1,394 @@
+/*
+A self-resizing array that stores each field of its elements in its own
+column.
+@file SoAVector.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	A self-resizing struct-of-arrays. Each element is a row of sizeof...(Ts)
+	fields, and every field lives in its own column: a separate MemoryManager
+	block aligned to ColumnAlignment. Loops that only need one field walk one
+	tightly packed, SIMD-friendly column instead of striding over whole rows.
+
+	All columns grow together. Since MemoryManager blocks carry no alignment
+	guarantee, each column over-allocates and is pinned with SetImmovable so
+	its aligned start never shifts. Fields must be trivially relocatable so
+	columns can be grown and rows swapped with memcpy.
+	*/
+	template <class... Ts>
+	class SoAVector
+	{
+		static_assert(sizeof...(Ts) > 0, "SoAVector needs at least one column.");
+		static_assert((IsTriviallyRelocatable<Ts>::value && ...),
+			"SoAVector columns are moved with memcpy.");
+
+	public:
+		static constexpr ArraySize ColumnCount = sizeof...(Ts);
+		static constexpr PtrSize ColumnAlignment = 32;
+
+		static_assert(((alignof(Ts) <= ColumnAlignment) && ...),
+			"SoAVector columns are only aligned to ColumnAlignment.");
+
+		template <ArraySize Column>
+		using ColumnType = typename std::tuple_element<Column, std::tuple<Ts...>>::type;
+
+		/*
+		@param capacity - Number of preallocated rows.
+		*/
+		SoAVector(ArraySize capacity = 16);
+		SoAVector(SoAVector&& otherVector);
+
+		~SoAVector();
+
+		SoAVector<Ts...>& operator=(SoAVector&& otherVector);
+
+		/*
+		Adds a new row to the end of this SoAVector.
+
+		@param values - One value per column.
+		*/
+		void Push(const Ts&... values);
+
+		/*
+		Removes the last row of this SoAVector.
+		*/
+		void Pop();
+
+		/*
+		Removes the row at the given index by moving the last row into its
+		place. Does not preserve row order.
+
+		@param index - The index of the row to remove.
+		*/
+		void SwapRemove(ArraySize index);
+
+		/*
+		Destructs every row, keeping the columns' memory.
+		*/
+		void Clear();
+
+		/*
+		Grows every column so this SoAVector can hold at least the given
+		number of rows without reallocating.
+
+		@param capacity - The number of rows to make room for.
+		*/
+		void Reserve(ArraySize capacity);
+
+		/*
+		Gets one field of one row.
+
+		@param index - The index of the row.
+
+		@return Reference to the field in the given column.
+		*/
+		template <ArraySize Column>
+		ColumnType<Column>& Get(ArraySize index);
+
+		template <ArraySize Column>
+		const ColumnType<Column>& Get(ArraySize index) const;
+
+		/*
+		Gets the start of a column, aligned to ColumnAlignment. The column
+		holds Length() contiguous values and stays valid until this SoAVector
+		grows.
+
+		@return Pointer to the first value of the column.
+		*/
+		template <ArraySize Column>
+		ColumnType<Column>* GetColumn();
+
+		template <ArraySize Column>
+		const ColumnType<Column>* GetColumn() const;
+
+		/*
+		Gets the current number of rows in this SoAVector.
+
+		@return ArraySize containing the number of rows.
+		*/
+		ArraySize Length() const;
+
+		/*
+		Gets the number of rows this SoAVector can hold before it needs to
+		grow.
+
+		@return ArraySize containing the capacity.
+		*/
+		ArraySize Capacity() const;
+
+		SoAVector(const SoAVector&) = delete;
+		SoAVector<Ts...>& operator=(const SoAVector&) = delete;
+
+	private:
+		typedef std::index_sequence_for<Ts...> Columns;
+
+		template <PtrSize... Is>
+		void PushRow(std::index_sequence<Is...>, const Ts&... values);
+
+		template <PtrSize... Is>
+		void DestroyRows(std::index_sequence<Is...>, ArraySize index, ArraySize count);
+
+		template <PtrSize... Is>
+		void MoveRow(std::index_sequence<Is...>, ArraySize from, ArraySize to);
+
+		template <PtrSize... Is>
+		void Reallocate(std::index_sequence<Is...>, ArraySize capacity);
+
+		/*
+		Allocates one pinned column and returns the aligned start of it.
+
+		@param handle - Receives the handle that owns the column.
+
+		@param byteCount - The number of bytes the column needs.
+
+		@return Pointer to the aligned start of the column.
+		*/
+		static void* AllocateColumn(UniqueHandle<Byte>& handle, ByteCount byteCount);
+
+	private:
+		UniqueHandle<Byte> m_Handles[ColumnCount]; // Owns each column's block.
+		void* m_Columns[ColumnCount]; // Aligned start of each column.
+		ArraySize m_Capacity; // Number of rows every column can hold.
+		ArraySize m_Length; // Number of live rows.
+	};
+
+	template <class... Ts>
+	SoAVector<Ts...>::SoAVector(ArraySize capacity) :
+		m_Columns(),
+		m_Capacity(0),
+		m_Length(0)
+	{
+		Reallocate(Columns(), capacity > 0 ? capacity : 1);
+	}
+
+	template <class... Ts>
+	SoAVector<Ts...>::SoAVector(SoAVector&& otherVector) :
+		m_Capacity(otherVector.m_Capacity),
+		m_Length(otherVector.m_Length)
+	{
+		for (ArraySize i = 0; i < ColumnCount; ++i)
+		{
+			m_Handles[i] = std::move(otherVector.m_Handles[i]);
+			m_Columns[i] = otherVector.m_Columns[i];
+			otherVector.m_Columns[i] = nullptr;
+		}
+
+		otherVector.m_Capacity = 0;
+		otherVector.m_Length = 0;
+	}
+
+	template <class... Ts>
+	SoAVector<Ts...>::~SoAVector()
+	{
+		// The columns are raw bytes, so the rows have to be destructed here.
+		Clear();
+	}
+
+	template <class... Ts>
+	SoAVector<Ts...>& SoAVector<Ts...>::operator=(SoAVector&& otherVector)
+	{
+		if (this == &otherVector)
+		{
+			return *this;
+		}
+
+		Clear();
+		for (ArraySize i = 0; i < ColumnCount; ++i)
+		{
+			m_Handles[i] = std::move(otherVector.m_Handles[i]);
+			m_Columns[i] = otherVector.m_Columns[i];
+			otherVector.m_Columns[i] = nullptr;
+		}
+
+		m_Capacity = otherVector.m_Capacity;
+		m_Length = otherVector.m_Length;
+		otherVector.m_Capacity = 0;
+		otherVector.m_Length = 0;
+
+		return *this;
+	}
+
+	template <class... Ts>
+	void SoAVector<Ts...>::Push(const Ts&... values)
+	{
+		if (m_Length == m_Capacity)
+		{
+			Reallocate(Columns(), m_Capacity > 0 ? m_Capacity * 2 : 1);
+		}
+
+		PushRow(Columns(), values...);
+		++m_Length;
+	}
+
+	template <class... Ts>
+	void SoAVector<Ts...>::Pop()
+	{
+		Assert(m_Length > 0);
+
+		--m_Length;
+		DestroyRows(Columns(), m_Length, 1);
+	}
+
+	template <class... Ts>
+	void SoAVector<Ts...>::SwapRemove(ArraySize index)
+	{
+		Assert(index < m_Length);
+
+		DestroyRows(Columns(), index, 1);
+		--m_Length;
+		if (index != m_Length)
+		{
+			MoveRow(Columns(), m_Length, index);
+		}
+	}
+
+	template <class... Ts>
+	void SoAVector<Ts...>::Clear()
+	{
+		DestroyRows(Columns(), 0, m_Length);
+		m_Length = 0;
+	}
+
+	template <class... Ts>
+	void SoAVector<Ts...>::Reserve(ArraySize capacity)
+	{
+		if (capacity > m_Capacity)
+		{
+			Reallocate(Columns(), capacity);
+		}
+	}
+
+	template <class... Ts>
+	template <ArraySize Column>
+	typename SoAVector<Ts...>::template ColumnType<Column>& SoAVector<Ts...>::Get(ArraySize index)
+	{
+		Assert(index < m_Length);
+
+		return GetColumn<Column>()[index];
+	}
+
+	template <class... Ts>
+	template <ArraySize Column>
+	const typename SoAVector<Ts...>::template ColumnType<Column>& SoAVector<Ts...>::Get(ArraySize index) const
+	{
+		Assert(index < m_Length);
+
+		return GetColumn<Column>()[index];
+	}
+
+	template <class... Ts>
+	template <ArraySize Column>
+	typename SoAVector<Ts...>::template ColumnType<Column>* SoAVector<Ts...>::GetColumn()
+	{
+		return (ColumnType<Column>*)m_Columns[Column];
+	}
+
+	template <class... Ts>
+	template <ArraySize Column>
+	const typename SoAVector<Ts...>::template ColumnType<Column>* SoAVector<Ts...>::GetColumn() const
+	{
+		return (const ColumnType<Column>*)m_Columns[Column];
+	}
+
+	template <class... Ts>
+	ArraySize SoAVector<Ts...>::Length() const
+	{
+		return m_Length;
+	}
+
+	template <class... Ts>
+	ArraySize SoAVector<Ts...>::Capacity() const
+	{
+		return m_Capacity;
+	}
+
+	template <class... Ts>
+	template <PtrSize... Is>
+	void SoAVector<Ts...>::PushRow(std::index_sequence<Is...>, const Ts&... values)
+	{
+		(new (GetColumn<Is>() + m_Length) Ts(values), ...);
+	}
+
+	template <class... Ts>
+	template <PtrSize... Is>
+	void SoAVector<Ts...>::DestroyRows(std::index_sequence<Is...>, ArraySize index,
+		ArraySize count)
+	{
+		auto destroyColumn = [index, count](auto* column) {
+			typedef typename std::remove_pointer<decltype(column)>::type Field;
+			if constexpr (!std::is_trivially_destructible<Field>::value)
+			{
+				for (ArraySize i = index; i < index + count; ++i)
+				{
+					column[i].~Field();
+				}
+			}
+		};
+
+		(destroyColumn(GetColumn<Is>()), ...);
+	}
+
+	template <class... Ts>
+	template <PtrSize... Is>
+	void SoAVector<Ts...>::MoveRow(std::index_sequence<Is...>, ArraySize from,
+		ArraySize to)
+	{
+		(memcpy((void*)(GetColumn<Is>() + to), (const void*)(GetColumn<Is>() + from),
+			sizeof(Ts)), ...);
+	}
+
+	template <class... Ts>
+	template <PtrSize... Is>
+	void SoAVector<Ts...>::Reallocate(std::index_sequence<Is...>, ArraySize capacity)
+	{
+		Assert(capacity >= m_Length);
+
+		auto reallocateColumn = [this, capacity](ArraySize column, PtrSize fieldSize) {
+			UniqueHandle<Byte> newHandle;
+			void* newColumn = AllocateColumn(newHandle, capacity * fieldSize);
+
+			if (m_Length > 0)
+			{
+				memcpy(newColumn, m_Columns[column], m_Length * fieldSize);
+			}
+
+			m_Handles[column] = std::move(newHandle);
+			m_Columns[column] = newColumn;
+		};
+
+		(reallocateColumn(Is, sizeof(Ts)), ...);
+		m_Capacity = capacity;
+	}
+
+	template <class... Ts>
+	void* SoAVector<Ts...>::AllocateColumn(UniqueHandle<Byte>& handle,
+		ByteCount byteCount)
+	{
+		handle = MemoryManager::AllocateArray<Byte>(byteCount + ColumnAlignment - 1);
+		handle.SetImmovable(true);
+
+		PtrSize start = (PtrSize)handle.GetMemory();
+		return (void*)((start + ColumnAlignment - 1) & ~(ColumnAlignment - 1));
+	}
+
+	template <class... Ts>
+	struct IsTriviallyRelocatable<SoAVector<Ts...>> : std::true_type {};
+}
\ No newline at end of file
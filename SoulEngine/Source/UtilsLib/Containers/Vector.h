@@ -2,14 +2,20 @@
 A self-resizing array that behaves similarly to the C Standard Library Vector.
 @file Vector.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #pragma once
 
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 #include <Memory/MemoryManager.h>
 #include <Memory/UniqueHandle.h>
 #include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/TypeTraits.h>
 
 namespace Soul
 {
@@ -47,6 +53,36 @@ namespace Soul
 		*/
 		void Push(T&& element);
 
+		/*
+		Constructs a new element in place at the end of this Vector.
+
+		@param args - Arguments forwarded to the element's constructor.
+
+		@return Reference to the newly constructed element.
+		*/
+		template <class... Args>
+		T& EmplaceBack(Args&&... args);
+
+		/*
+		Inserts a new element at the given index, shifting every element at
+		or after that index up by one.
+
+		@param index - The index the new element will be placed at.
+
+		@param element - The element to insert into this Vector.
+		*/
+		void Insert(ArraySize index, const T& element);
+
+		/*
+		Inserts a new element at the given index, shifting every element at
+		or after that index up by one.
+
+		@param index - The index the new element will be placed at.
+
+		@param element - The element to insert into this Vector.
+		*/
+		void Insert(ArraySize index, T&& element);
+
 		/*
 		Removes and returns the element at the end of this Vector.
 
@@ -61,6 +97,42 @@ namespace Soul
 		*/
 		void Remove(ArraySize index);
 
+		/*
+		Removes a run of elements starting at the given index, shifting the
+		elements after the run down in a single pass.
+
+		@param index - The index of the first element to be removed.
+
+		@param count - The number of elements to remove.
+		*/
+		void RemoveRange(ArraySize index, ArraySize count);
+
+		/*
+		Removes the element at the given index in constant time by moving the
+		last element into its place. Does not preserve element order.
+
+		@param index - The index of the element to be removed.
+		*/
+		void SwapRemove(ArraySize index);
+
+		/*
+		Removes every element from this Vector without releasing its memory.
+		*/
+		void Clear();
+
+		/*
+		Makes sure this Vector can hold at least the given number of elements
+		without having to resize.
+
+		@param capacity - The number of elements this Vector should fit.
+		*/
+		void Reserve(ArraySize capacity);
+
+		/*
+		Shrinks this Vector's memory down to fit only its current elements.
+		*/
+		void ShrinkToFit();
+
 		/*
 		Gets the current number of elements in this Vector.
 
@@ -68,6 +140,13 @@ namespace Soul
 		*/
 		ArraySize Length() const;
 
+		/*
+		Gets the number of elements this Vector can hold before resizing.
+
+		@return ArraySize containing the capacity of this Vector.
+		*/
+		ArraySize Capacity() const;
+
 		Vector() = delete;
 		Vector(const Vector&) = delete;
 
@@ -77,6 +156,24 @@ namespace Soul
 		*/
 		void Resize();
 
+		/*
+		Moves the live elements into a new block of memory with the given
+		capacity.
+
+		@param capacity - The capacity of the new memory.
+		*/
+		void Reallocate(ArraySize capacity);
+
+		/*
+		Destructs a run of elements and zeroes their slots, leaving them in the
+		same state as freshly allocated capacity.
+
+		@param index - The index of the first element to destroy.
+
+		@param count - The number of elements to destroy.
+		*/
+		void DestroyElements(ArraySize index, ArraySize count);
+
 	private:
 		UniqueHandle<T> m_Elements;
 		ArraySize m_Capacity;
@@ -141,7 +238,7 @@ namespace Soul
 			Resize();
 		}
 
-		m_Elements[m_Length++] = element;
+		new (m_Elements.GetMemory() + m_Length++) T(element);
 	}
 
 	template <class T>
@@ -152,48 +249,172 @@ namespace Soul
 			Resize();
 		}
 
-		m_Elements[m_Length++] = std::move(element);
+		new (m_Elements.GetMemory() + m_Length++) T(std::move(element));
+	}
+
+	template <class T>
+	template <class... Args>
+	T& Vector<T>::EmplaceBack(Args&&... args)
+	{
+		if (m_Length == m_Capacity)
+		{
+			Resize();
+		}
+
+		return *new (m_Elements.GetMemory() + m_Length++)
+			T(std::forward<Args>(args)...);
+	}
+
+	template <class T>
+	void Vector<T>::Insert(ArraySize index, const T& element)
+	{
+		Insert(index, T(element));
+	}
+
+	template <class T>
+	void Vector<T>::Insert(ArraySize index, T&& element)
+	{
+		Assert(index <= m_Length);
+
+		if (m_Length == m_Capacity)
+		{
+			Resize();
+		}
+
+		T* elements = m_Elements.GetMemory();
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			memmove(elements + index + 1, elements + index,
+				(m_Length - index) * sizeof(T));
+		}
+		else if (index < m_Length)
+		{
+			new (elements + m_Length) T(std::move(elements[m_Length - 1]));
+			for (ArraySize i = m_Length - 1; i > index; --i)
+			{
+				elements[i] = std::move(elements[i - 1]);
+			}
+			elements[index].~T();
+		}
+
+		new (elements + index) T(std::move(element));
+		++m_Length;
 	}
 
 	template <class T>
 	T Vector<T>::Pop()
 	{
 		Assert(m_Length > 0);
-		
-		return std::move(m_Elements[--m_Length]);
+
+		T element(std::move(m_Elements[--m_Length]));
+		DestroyElements(m_Length, 1);
+
+		return element;
 	}
 
 	template <class T>
 	void Vector<T>::Remove(ArraySize index)
 	{
-		Assert(index >= 0);
-		Assert(index < m_Length);
-		m_Elements[index].~T();
+		RemoveRange(index, 1);
+	}
 
-		// Move memory in front of this element over.
-		// New method: Move every element over individually with std::move
+	template <class T>
+	void Vector<T>::RemoveRange(ArraySize index, ArraySize count)
+	{
+		Assert(index + count <= m_Length);
 
-		for (ArraySize i = index; i < m_Length - 1; ++i)
+		T* elements = m_Elements.GetMemory();
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			/*
+			Destroy the removed elements and slide everything in front of
+			them over in one go. The vacated slots at the end are zeroed so
+			they aren't destructed a second time when the Vector is freed.
+			*/
+			if constexpr (!std::is_trivially_destructible<T>::value)
+			{
+				for (ArraySize i = index; i < index + count; ++i)
+				{
+					elements[i].~T();
+				}
+			}
+			memmove(elements + index, elements + index + count,
+				(m_Length - index - count) * sizeof(T));
+			m_Length -= count;
+			if constexpr (!std::is_trivially_copyable<T>::value)
+			{
+				memset(elements + m_Length, 0, count * sizeof(T));
+			}
+		}
+		else
 		{
-			// We have to set the memory for the current element to 0's so
-			// we're not calling the move assignment on data that's already
-			// dead
-			memset(&(m_Elements[i]), 0, sizeof(T));
-			m_Elements[i] = std::move(m_Elements[i + 1]);
+			/*
+			Move every element over individually, then destroy the moved-from
+			elements left at the end.
+			*/
+			for (ArraySize i = index; i + count < m_Length; ++i)
+			{
+				elements[i] = std::move(elements[i + count]);
+			}
+
+			m_Length -= count;
+			DestroyElements(m_Length, count);
 		}
+	}
+
+	template <class T>
+	void Vector<T>::SwapRemove(ArraySize index)
+	{
+		Assert(index < m_Length);
 
 		--m_Length;
-		memset(&(m_Elements[m_Length]), 0, sizeof(T));
+		if (index != m_Length)
+		{
+			T* elements = m_Elements.GetMemory();
+			if constexpr (IsTriviallyRelocatable<T>::value)
+			{
+				elements[index].~T();
+				memcpy(elements + index, elements + m_Length, sizeof(T));
+				if constexpr (!std::is_trivially_copyable<T>::value)
+				{
+					memset(elements + m_Length, 0, sizeof(T));
+				}
+				return;
+			}
+			else
+			{
+				elements[index] = std::move(elements[m_Length]);
+			}
+		}
 
-		// The following doesn't work. I assume this is because it's only doing a shallow
-		// memory copy, so when we actually try to do anything the memory we could get a bunch
-		// of errors because it's trying to reference deep data that couldn't be transferred
+		DestroyElements(m_Length, 1);
+	}
 
-		/*ArraySize elementsToMove = m_Length - (index + 1);
-		memcpy(&(m_Elements[index]), &(m_Elements[index + 1]),
-			elementsToMove * sizeof(T));
-		--m_Length;
-		memset(&(m_Elements[m_Length]), 0, sizeof(T));*/
+	template <class T>
+	void Vector<T>::Clear()
+	{
+		DestroyElements(0, m_Length);
+		m_Length = 0;
+	}
+
+	template <class T>
+	void Vector<T>::Reserve(ArraySize capacity)
+	{
+		if (capacity > m_Capacity)
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	template <class T>
+	void Vector<T>::ShrinkToFit()
+	{
+		// Keep at least one slot so the Vector always owns valid memory.
+		ArraySize capacity = m_Length > 0 ? m_Length : 1;
+		if (capacity < m_Capacity)
+		{
+			Reallocate(capacity);
+		}
 	}
 
 	template <class T>
@@ -202,40 +423,91 @@ namespace Soul
 		return m_Length;
 	}
 
+	template <class T>
+	ArraySize Vector<T>::Capacity() const
+	{
+		return m_Capacity;
+	}
+
 	template <class T>
 	void Vector<T>::Resize()
+	{
+		Reallocate(m_Capacity * 2 + 1);
+	}
+
+	template <class T>
+	void Vector<T>::Reallocate(ArraySize capacity)
 	{
 		/*
-		Request new memory for expanded capacity.
+		Request new memory for the new capacity.
 		*/
-		ArraySize oldCapacity = m_Capacity;
-		m_Capacity = m_Capacity * 2 + 1;
+		m_Capacity = capacity;
 		UniqueHandle<T> newMemory = MemoryManager::AllocateArray<T>(m_Capacity);
-		if (m_Elements.IsImmovable())
+		if (m_Elements.IsValid() && m_Elements.IsImmovable())
 		{
 			newMemory.SetImmovable(true);
 		}
-		
-		// New method: Move every element over individually, clean up old memory
 
-		for (ArraySize i = 0; i < oldCapacity; ++i)
+		/*
+		A moved from Vector has no memory and nothing to relocate.
+		*/
+		if (!m_Elements.IsValid())
 		{
-			newMemory[i] = std::move(m_Elements[i]);
+			m_Elements = std::move(newMemory);
+			return;
 		}
-		memset(m_Elements.GetMemory(), 0, sizeof(T) * oldCapacity);
+
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			/*
+			Relocate the live elements with a single copy. Types that own
+			deep data get their old slots zeroed so freeing the old memory
+			doesn't destruct what the new memory now owns.
+			*/
+			memcpy(newMemory.GetMemory(), m_Elements.GetMemory(),
+				sizeof(T) * m_Length);
+			if constexpr (!std::is_trivially_copyable<T>::value)
+			{
+				memset(m_Elements.GetMemory(), 0, sizeof(T) * m_Length);
+			}
+		}
+		else
+		{
+			/*
+			Move construct every live element into the new memory. The
+			moved-from elements are destructed along with the old memory.
+			*/
+			for (ArraySize i = 0; i < m_Length; ++i)
+			{
+				new (&(newMemory[i])) T(std::move(m_Elements[i]));
+			}
+		}
+
 		m_Elements = std::move(newMemory);
+	}
 
-		
-		// The following doesn't work. I assume this is because it's only doing a shallow
-		// memory copy, so when we actually try to do anything the memory we could get a bunch
-		// of errors because it's trying to reference deep data that couldn't be transferred
-
-		///*
-		//Move memory and deallocate old memory.
-		//*/
-		//memcpy(newMemory.GetMemory(), m_Elements.GetMemory(),
-		//	sizeof(T) * oldCapacity);
-		//memset(m_Elements.GetMemory(), 0, sizeof(T) * oldCapacity);
-		//m_Elements = std::move(newMemory);
+	template <class T>
+	void Vector<T>::DestroyElements(ArraySize index, ArraySize count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		T* elements = m_Elements.GetMemory();
+		if constexpr (!std::is_trivially_destructible<T>::value)
+		{
+			for (ArraySize i = index; i < index + count; ++i)
+			{
+				elements[i].~T();
+			}
+		}
+		if constexpr (!std::is_trivially_copyable<T>::value)
+		{
+			memset(elements + index, 0, count * sizeof(T));
+		}
 	}
+
+	template <class T>
+	struct IsTriviallyRelocatable<Vector<T>> : std::true_type {};
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+/*
+A fixed-size, allocation-free callable wrapper.
+@file Delegate.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+
+namespace Soul
+{
+	template <class Signature, PtrSize Capacity = 3 * sizeof(void*)>
+	class Delegate;
+
+	/*
+	A lightweight replacement for std::function. A Delegate holds a function
+	pointer, a bound member function, or a lambda whose captures fit in
+	Capacity bytes, all stored inline, so creating one never allocates.
+	Captures must be trivially copyable, which keeps the Delegate itself
+	trivially copyable: containers can memcpy it around and a zeroed
+	Delegate is a valid, empty Delegate.
+
+	Calling a Delegate is one indirect call through a small invoker function
+	with no further type erasure.
+	*/
+	template <class R, class... Args, PtrSize Capacity>
+	class Delegate<R(Args...), Capacity>
+	{
+	public:
+		Delegate();
+
+		/*
+		Wraps a function pointer or a lambda.
+
+		@param function - The callable to wrap. Must be trivially copyable,
+		                  and no larger than Capacity.
+		*/
+		template <class Function, class = typename std::enable_if<
+			!std::is_same<typename std::decay<Function>::type, Delegate>::value>::type>
+		Delegate(Function function);
+
+		/*
+		Creates a Delegate that calls a member function on an object.
+
+		@param object - The object to call the member function on. Must
+		                outlive the Delegate.
+
+		@return Delegate that calls (object->*Method)(args...).
+		*/
+		template <auto Method, class Class>
+		static Delegate Bind(Class* object);
+
+		/*
+		Calls the wrapped callable. The Delegate must be valid.
+
+		@param args - Arguments forwarded to the callable.
+
+		@return Whatever the callable returns.
+		*/
+		R operator()(Args... args) const;
+
+		/*
+		Returns whether this Delegate wraps a callable.
+
+		@return Whether this Delegate can be called.
+		*/
+		bool IsValid() const;
+
+	private:
+		typedef R (*Invoker)(void* storage, Args... args);
+
+		template <class Function>
+		static R InvokeFunction(void* storage, Args... args);
+
+		template <auto Method, class Class>
+		static R InvokeMethod(void* storage, Args... args);
+
+	private:
+		Invoker m_Invoke; // Calls the callable in m_Storage, or nullptr if empty.
+		alignas(void*) Byte m_Storage[Capacity]; // The callable itself.
+	};
+
+	template <class R, class... Args, PtrSize Capacity>
+	Delegate<R(Args...), Capacity>::Delegate() :
+		m_Invoke(nullptr),
+		m_Storage()
+	{
+	}
+
+	template <class R, class... Args, PtrSize Capacity>
+	template <class Function, class>
+	Delegate<R(Args...), Capacity>::Delegate(Function function) :
+		m_Invoke(&InvokeFunction<Function>),
+		m_Storage()
+	{
+		static_assert(std::is_trivially_copyable<Function>::value,
+			"Delegate captures must be trivially copyable.");
+		static_assert(sizeof(Function) <= Capacity,
+			"Delegate captures don't fit in the inline storage.");
+		static_assert(alignof(Function) <= alignof(void*),
+			"Delegate captures are over-aligned.");
+
+		new (m_Storage) Function(function);
+	}
+
+	template <class R, class... Args, PtrSize Capacity>
+	template <auto Method, class Class>
+	Delegate<R(Args...), Capacity> Delegate<R(Args...), Capacity>::Bind(Class* object)
+	{
+		Delegate delegate;
+		delegate.m_Invoke = &InvokeMethod<Method, Class>;
+		new (delegate.m_Storage) Class*(object);
+		return delegate;
+	}
+
+	template <class R, class... Args, PtrSize Capacity>
+	R Delegate<R(Args...), Capacity>::operator()(Args... args) const
+	{
+		Assert(m_Invoke);
+
+		return m_Invoke((void*)m_Storage, std::forward<Args>(args)...);
+	}
+
+	template <class R, class... Args, PtrSize Capacity>
+	bool Delegate<R(Args...), Capacity>::IsValid() const
+	{
+		return m_Invoke != nullptr;
+	}
+
+	template <class R, class... Args, PtrSize Capacity>
+	template <class Function>
+	R Delegate<R(Args...), Capacity>::InvokeFunction(void* storage, Args... args)
+	{
+		return (*(Function*)storage)(std::forward<Args>(args)...);
+	}
+
+	template <class R, class... Args, PtrSize Capacity>
+	template <auto Method, class Class>
+	R Delegate<R(Args...), Capacity>::InvokeMethod(void* storage, Args... args)
+	{
+		return ((*(Class**)storage)->*Method)(std::forward<Args>(args)...);
+	}
+}
\ No newline at end of file
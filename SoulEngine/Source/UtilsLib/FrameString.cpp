@@ -0,0 +1,161 @@
+/*
+A string that lives entirely in the MemoryManager's volatile arena, used for
+building temporary text during a single frame.
+@file FrameString.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "FrameString.h"
+
+#include <cstring>
+
+#include <Memory/MemoryManager.h>
+#include <UtilsLib/Macros.h>
+
+namespace Soul
+{
+	char FrameString::m_EmptyString[1] = { '\0' };
+
+	FrameString::FrameString() :
+		m_CString(MemoryManager::AllocateVolatile<char>(16)),
+		m_Length(0),
+		m_Capacity(16),
+		m_FrameIndex(MemoryManager::GetFrameIndex())
+	{
+		m_CString[0] = '\0';
+	}
+
+	FrameString::FrameString(const char* string) :
+		m_Length(strlen(string)),
+		m_Capacity(m_Length + 1),
+		m_FrameIndex(MemoryManager::GetFrameIndex())
+	{
+		m_CString = MemoryManager::AllocateVolatile<char>(m_Capacity);
+		memcpy(m_CString, string, m_Capacity);
+	}
+
+	FrameString::FrameString(FrameString&& otherString) :
+		m_CString(otherString.m_CString),
+		m_Length(otherString.m_Length),
+		m_Capacity(otherString.m_Capacity),
+		m_FrameIndex(otherString.m_FrameIndex)
+	{
+		otherString.m_CString = m_EmptyString;
+		otherString.m_Length = 0;
+		otherString.m_Capacity = 0;
+	}
+
+	FrameString& FrameString::operator=(FrameString&& otherString)
+	{
+		m_CString = otherString.m_CString;
+		m_Length = otherString.m_Length;
+		m_Capacity = otherString.m_Capacity;
+		m_FrameIndex = otherString.m_FrameIndex;
+		otherString.m_CString = m_EmptyString;
+		otherString.m_Length = 0;
+		otherString.m_Capacity = 0;
+
+		return *this;
+	}
+
+	FrameString& FrameString::operator+=(const char* string)
+	{
+		Append(string, strlen(string));
+
+		return *this;
+	}
+
+	FrameString& FrameString::operator+=(char character)
+	{
+		Append(&character, 1);
+
+		return *this;
+	}
+
+	bool FrameString::operator==(const char* string) const
+	{
+		Assert(IsValid());
+		return strcmp(m_CString, string) == 0;
+	}
+
+	bool FrameString::operator!=(const char* string) const
+	{
+		return !(*this == string);
+	}
+
+	char& FrameString::operator[](Index index)
+	{
+		Assert(IsValid());
+		Assert(index < m_Length);
+		return m_CString[index];
+	}
+
+	const char& FrameString::operator[](Index index) const
+	{
+		Assert(IsValid());
+		Assert(index < m_Length);
+		return m_CString[index];
+	}
+
+	FrameString::operator const char*() const
+	{
+		return GetCString();
+	}
+
+	void FrameString::Append(const char* string, ArraySize length)
+	{
+		Assert(IsValid());
+
+		Reserve(m_Length + length);
+		memcpy(m_CString + m_Length, string, length);
+		m_Length += length;
+		m_CString[m_Length] = '\0';
+	}
+
+	ArraySize FrameString::Length() const
+	{
+		return m_Length;
+	}
+
+	const char* FrameString::GetCString() const
+	{
+		Assert(IsValid());
+		return m_CString;
+	}
+
+	bool FrameString::IsValid() const
+	{
+		return m_FrameIndex == MemoryManager::GetFrameIndex();
+	}
+
+	void FrameString::Reserve(ArraySize length)
+	{
+		if (length + 1 <= m_Capacity)
+		{
+			return;
+		}
+
+		ArraySize newCapacity = m_Capacity * 2;
+		if (newCapacity < length + 1)
+		{
+			newCapacity = length + 1;
+		}
+
+		/*
+		If nothing was allocated after us we can simply bump the arena. Moved
+		from strings point at m_EmptyString, which isn't in the arena.
+		*/
+		if (m_Capacity > 0 &&
+			MemoryManager::ExtendVolatile<char>(m_CString, m_Capacity, newCapacity))
+		{
+			m_Capacity = newCapacity;
+			return;
+		}
+
+		char* newMemory = MemoryManager::AllocateVolatile<char>(newCapacity);
+		memcpy(newMemory, m_CString, m_Length + 1);
+		m_CString = newMemory;
+		m_Capacity = newCapacity;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+/*
+A string that lives entirely in the MemoryManager's volatile arena, used for
+building temporary text during a single frame.
+@file FrameString.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <UtilsLib/CommonTypes.h>
+
+namespace Soul
+{
+	/*
+	A string that lives entirely in the MemoryManager's volatile arena.
+	Appending grows the string in place when it is the most recent volatile
+	allocation, and otherwise bump allocates a new buffer.
+
+	A FrameString is only valid during the frame it was created in, and must
+	not be used after MemoryManager::IncrementFrameCounter() has been called.
+	Copy it into a String if it needs to persist. A FrameString that has
+	been moved from is left as a valid, empty string.
+	*/
+	class FrameString
+	{
+	public:
+		FrameString();
+		FrameString(const char* string);
+		FrameString(FrameString&& otherString);
+
+		FrameString& operator=(FrameString&& otherString);
+		FrameString& operator+=(const char* string);
+		FrameString& operator+=(char character);
+		bool operator==(const char* string) const;
+		bool operator!=(const char* string) const;
+		char& operator[](Index index);
+		const char& operator[](Index index) const;
+		operator const char*() const;
+
+		/*
+		Appends the provided C-String to the end of this FrameString.
+
+		@param string - The C-String to append.
+
+		@param length - The number of characters to append from string.
+		*/
+		void Append(const char* string, ArraySize length);
+
+		/*
+		Returns the length of this FrameString.
+
+		@return - Length of the string.
+		*/
+		ArraySize Length() const;
+
+		/*
+		Get's the underlying C-String for this FrameString.
+
+		@return - Pointer to the underlying C-String.
+		*/
+		const char* GetCString() const;
+
+		/*
+		Returns whether this FrameString's memory is still alive, meaning the
+		frame it was created in has not ended yet.
+
+		@return Whether this FrameString can still be used.
+		*/
+		bool IsValid() const;
+
+		FrameString(const FrameString&) = delete;
+		FrameString& operator=(const FrameString&) = delete;
+
+	private:
+		/*
+		Makes sure this FrameString can hold at least the provided number of
+		characters, not including the null terminator.
+
+		@param length - Number of characters that need to fit.
+		*/
+		void Reserve(ArraySize length);
+
+	private:
+		char* m_CString; // Volatile memory holding the C-String
+		ArraySize m_Length; // Length of currently stored C-String
+		ArraySize m_Capacity; // Capacity of m_CString, including null terminator
+		UInt64 m_FrameIndex; // Frame this FrameString was allocated in
+
+		static char m_EmptyString[1]; // Shared by moved from FrameStrings, which have no capacity
+	};
+}
\ No newline at end of file
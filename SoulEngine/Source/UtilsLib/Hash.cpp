@@ -0,0 +1,54 @@
+/*
+Hash functions used by the engine's hashed containers.
+@file Hash.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "Hash.h"
+
+#include <cstring>
+
+namespace Soul
+{
+	// Finalizer from MurmurHash3.
+	UInt64 HashInteger(UInt64 value)
+	{
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdULL;
+		value ^= value >> 33;
+		value *= 0xc4ceb9fe1a85ec53ULL;
+		value ^= value >> 33;
+
+		return value;
+	}
+
+	// Word at a time multiply-xorshift in the style of MurmurHash64A.
+	UInt64 HashBytes(const void* data, PtrSize byteCount)
+	{
+		const UInt64 multiplier = 0xc6a4a7935bd1e995ULL;
+		const Byte* bytes = (const Byte*)data;
+		UInt64 hash = 0xcbf29ce484222325ULL ^ (byteCount * multiplier);
+
+		while (byteCount >= 8)
+		{
+			UInt64 word;
+			memcpy(&word, bytes, 8);
+			word *= multiplier;
+			word ^= word >> 47;
+			word *= multiplier;
+			hash ^= word;
+			hash *= multiplier;
+
+			bytes += 8;
+			byteCount -= 8;
+		}
+
+		UInt64 tail = 0;
+		memcpy(&tail, bytes, byteCount);
+		hash ^= tail;
+		hash *= multiplier;
+
+		return HashInteger(hash);
+	}
+}
\ No newline at end of file
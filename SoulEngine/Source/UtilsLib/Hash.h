@@ -0,0 +1,54 @@
+/*
+Hash functions used by the engine's hashed containers.
+@file Hash.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <type_traits>
+
+#include <UtilsLib/CommonTypes.h>
+
+namespace Soul
+{
+	/*
+	Scrambles the bits of an integer so that every input bit affects every
+	output bit. Used to turn keys that are already well spread, like ids and
+	pointers, into hashes whose low and high bits are both usable.
+
+	@param value - The integer to scramble.
+
+	@return UInt64 containing the scrambled value.
+	*/
+	UInt64 HashInteger(UInt64 value);
+
+	/*
+	Hashes an arbitrary run of bytes.
+
+	@param data - Pointer to the bytes to hash.
+
+	@param byteCount - The number of bytes to hash.
+
+	@return UInt64 containing the hash of the bytes.
+	*/
+	UInt64 HashBytes(const void* data, PtrSize byteCount);
+
+	/*
+	Function object used by hashed containers to hash their keys. Integers,
+	enums and pointers are supported out of the box; other key types opt in
+	by specializing Hash next to their declaration.
+	*/
+	template <class T>
+	struct Hash
+	{
+		static_assert(std::is_integral<T>::value || std::is_enum<T>::value ||
+			std::is_pointer<T>::value, "No Hash specialization for this type.");
+
+		UInt64 operator()(const T& value) const
+		{
+			return HashInteger((UInt64)value);
+		}
+	};
+}
\ No newline at end of file
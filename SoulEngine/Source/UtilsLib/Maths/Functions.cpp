@@ -2,7 +2,7 @@
 A library of common math functions.
 @file Functions.cpp
 @author Jacob Peterson
-@edited 4/25/21
+@edited 10/19/26
 */
 
 #include "Functions.h"
@@ -30,4 +30,16 @@ namespace Soul
 
 		return u.x;
 	}
+
+	ArraySize NextPowerOfTwo(ArraySize x)
+	{
+		// Smear the highest set bit of x - 1 into every lower bit.
+		--x;
+		for (ArraySize shift = 1; shift < sizeof(ArraySize) * 8; shift <<= 1)
+		{
+			x |= x >> shift;
+		}
+
+		return x + 1;
+	}
 }
\ No newline at end of file
@@ -2,11 +2,15 @@
 A library of common math functions.
 @file Functions.h
 @author Jacob Peterson
-@edited 4/25/21
+@edited 10/19/26
 */
 
 #pragma once
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 #include <UtilsLib/CommonTypes.h>
 
 namespace Soul
@@ -19,4 +23,50 @@ namespace Soul
 	@return Float containing the resulting square root.
 	*/
 	Float32 SquareRoot(const Float32 x);
+
+	/*
+	Returns the smallest power of two that is greater than or equal to the
+	provided number.
+
+	@param x - Number to round up. Must be greater than zero.
+
+	@return ArraySize containing the rounded up power of two.
+	*/
+	ArraySize NextPowerOfTwo(ArraySize x);
+
+	/*
+	Returns the number of zero bits below the lowest set bit of the provided
+	number. Inlined since it sits in the middle of container probe loops.
+
+	@param x - Number to count the trailing zeros of. Must not be zero.
+
+	@return UInt32 containing the index of the lowest set bit.
+	*/
+	inline UInt32 CountTrailingZeros(UInt64 x)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward64(&index, x);
+		return (UInt32)index;
+#else
+		return (UInt32)__builtin_ctzll(x);
+#endif
+	}
+
+	/*
+	Returns the number of set bits in the provided number. Inlined since it
+	sits in the middle of bit array loops.
+
+	@param x - Number to count the set bits of.
+
+	@return UInt32 containing the number of set bits.
+	*/
+	inline UInt32 PopCount(UInt64 x)
+	{
+#ifdef _MSC_VER
+		return (UInt32)__popcnt64(x);
+#else
+		return (UInt32)__builtin_popcountll(x);
+#endif
+	}
 }
\ No newline at end of file
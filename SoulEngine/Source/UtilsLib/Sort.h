@@ -0,0 +1,481 @@
+/*
+Sorting and searching routines for Vectors and raw arrays.
+@file Sort.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Containers/Vector.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/TypeTraits.h>
+
+namespace Soul
+{
+	/*
+	Default comparison for the sorting routines, sorting in ascending order.
+	*/
+	struct Less
+	{
+		template <class T>
+		bool operator()(const T& a, const T& b) const
+		{
+			return a < b;
+		}
+	};
+
+	/*
+	Default key extraction for RadixSort, using the element itself as the key.
+	*/
+	struct Identity
+	{
+		template <class T>
+		const T& operator()(const T& element) const
+		{
+			return element;
+		}
+	};
+
+	/*
+	Converts an integer or floating point key into an unsigned integer of the
+	same size whose unsigned order matches the key's order. Signed integers
+	have their sign bit flipped, and floats additionally have their magnitude
+	bits flipped when negative.
+
+	@param key - The key to convert.
+
+	@return Unsigned integer with the same ordering as the key.
+	*/
+	template <class Key>
+	auto ToRadixKey(Key key)
+	{
+		static_assert(std::is_arithmetic<Key>::value,
+			"RadixSort keys must be integers or floating point numbers.");
+
+		if constexpr (std::is_floating_point<Key>::value)
+		{
+			static_assert(sizeof(Key) == 4 || sizeof(Key) == 8,
+				"RadixSort only supports 32 and 64 bit floats.");
+
+			typedef typename std::conditional<sizeof(Key) == 4, UInt32, UInt64>::type Bits;
+			constexpr Bits signBit = (Bits)1 << (sizeof(Bits) * 8 - 1);
+
+			Bits bits;
+			memcpy(&bits, &key, sizeof(Key));
+			return (Bits)(bits & signBit ? ~bits : bits | signBit);
+		}
+		else
+		{
+			typedef typename std::make_unsigned<Key>::type Bits;
+			constexpr Bits signBit = std::is_signed<Key>::value ?
+				(Bits)((Bits)1 << (sizeof(Bits) * 8 - 1)) : 0;
+
+			return (Bits)((Bits)key ^ signBit);
+		}
+	}
+
+	/*
+	Finds the first element that does not belong before the key, in sorted
+	elements. The loop always runs log2(count) times and picks each half with
+	a conditional move rather than a branch, so lookups don't stall on
+	mispredictions.
+
+	@param elements - The sorted elements to search.
+
+	@param count - The number of elements.
+
+	@param key - The key to search for.
+
+	@param compare - Returns whether its first argument belongs before its
+	                 second.
+
+	@return Index of the first element not before the key, or count if every
+	        element is.
+	*/
+	template <class T, class Key, class Compare = Less>
+	ArraySize LowerBound(const T* elements, ArraySize count, const Key& key,
+		Compare compare = Compare())
+	{
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		const T* base = elements;
+		while (count > 1)
+		{
+			ArraySize half = count / 2;
+			base = compare(base[half], key) ? base + half : base;
+			count -= half;
+		}
+
+		return (base - elements) + compare(*base, key);
+	}
+
+	/*
+	Sorts the elements with an insertion sort. Only worth it for short runs,
+	which is what MergeSort uses it for.
+
+	@param elements - The elements to sort.
+
+	@param count - The number of elements.
+
+	@param compare - Returns whether its first argument belongs before its
+	                 second.
+	*/
+	template <class T, class Compare>
+	void InsertionSort(T* elements, ArraySize count, Compare& compare)
+	{
+		for (ArraySize i = 1; i < count; ++i)
+		{
+			if (!compare(elements[i], elements[i - 1]))
+			{
+				continue;
+			}
+
+			T element(std::move(elements[i]));
+			ArraySize j = i;
+			do
+			{
+				elements[j] = std::move(elements[j - 1]);
+				--j;
+			} while (j > 0 && compare(element, elements[j - 1]));
+
+			elements[j] = std::move(element);
+		}
+	}
+
+	/*
+	Merges two sorted runs into destination. Equal elements are taken from
+	the first run first, so the merge is stable.
+
+	@param first - The first sorted run.
+
+	@param firstCount - The number of elements in the first run.
+
+	@param second - The second sorted run.
+
+	@param secondCount - The number of elements in the second run.
+
+	@param destination - Where to move the merged elements, with room for
+	                     firstCount + secondCount elements.
+
+	@param compare - Returns whether its first argument belongs before its
+	                 second.
+	*/
+	template <class T, class Compare>
+	void MergeRuns(T* first, ArraySize firstCount, T* second,
+		ArraySize secondCount, T* destination, Compare& compare)
+	{
+		T* firstEnd = first + firstCount;
+		T* secondEnd = second + secondCount;
+
+		while (first != firstEnd && second != secondEnd)
+		{
+			*destination++ = compare(*second, *first) ?
+				std::move(*second++) : std::move(*first++);
+		}
+		while (first != firstEnd)
+		{
+			*destination++ = std::move(*first++);
+		}
+		while (second != secondEnd)
+		{
+			*destination++ = std::move(*second++);
+		}
+	}
+
+	/*
+	Sorts the elements with a single threaded, bottom-up merge sort. The
+	sorted elements always end up back in elements.
+
+	@param elements - The elements to sort.
+
+	@param scratch - Temporary storage for at least count elements.
+
+	@param count - The number of elements.
+
+	@param compare - Returns whether its first argument belongs before its
+	                 second.
+	*/
+	template <class T, class Compare>
+	void MergeSortRange(T* elements, T* scratch, ArraySize count, Compare& compare)
+	{
+		constexpr ArraySize runLength = 32;
+
+		for (ArraySize i = 0; i < count; i += runLength)
+		{
+			InsertionSort(elements + i, count - i < runLength ? count - i : runLength,
+				compare);
+		}
+
+		T* source = elements;
+		T* destination = scratch;
+		for (ArraySize width = runLength; width < count; width *= 2)
+		{
+			for (ArraySize i = 0; i < count; i += 2 * width)
+			{
+				ArraySize firstCount = count - i < width ? count - i : width;
+				ArraySize secondStart = i + firstCount;
+				ArraySize secondCount = count - secondStart < width ?
+					count - secondStart : width;
+
+				MergeRuns(source + i, firstCount, source + secondStart, secondCount,
+					destination + i, compare);
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != elements)
+		{
+			for (ArraySize i = 0; i < count; ++i)
+			{
+				elements[i] = std::move(source[i]);
+			}
+		}
+	}
+
+	/*
+	Sorts the elements with a stable merge sort. Large inputs are split into
+	one slice per thread, the slices are sorted in parallel, and then merged
+	pairwise in parallel rounds. Temporary storage for count elements is
+	taken from the MemoryManager for the duration of the call, so this must
+	be called from the thread that owns the MemoryManager.
+
+	@param elements - The elements to sort.
+
+	@param count - The number of elements.
+
+	@param compare - Returns whether its first argument belongs before its
+	                 second.
+
+	@param threadCount - The maximum number of threads to sort with, or 0 to
+	                     use every hardware thread.
+	*/
+	template <class T, class Compare = Less>
+	void MergeSort(T* elements, ArraySize count, Compare compare = Compare(),
+		UInt32 threadCount = 0)
+	{
+		constexpr ArraySize minSliceLength = 16384;
+		constexpr UInt32 maxSlices = 64;
+
+		if (count < 2)
+		{
+			return;
+		}
+
+		if (threadCount == 0)
+		{
+			threadCount = std::thread::hardware_concurrency();
+		}
+
+		// Slice count is a power of two so the merge rounds pair up evenly.
+		UInt32 sliceCount = 1;
+		while (sliceCount * 2 <= threadCount && sliceCount * 2 <= maxSlices &&
+			count / (sliceCount * 2) >= minSliceLength)
+		{
+			sliceCount *= 2;
+		}
+
+		UniqueHandle<T> scratchHandle = MemoryManager::AllocateArray<T>(count);
+		T* scratch = scratchHandle.GetMemory();
+
+		if (sliceCount == 1)
+		{
+			MergeSortRange(elements, scratch, count, compare);
+			return;
+		}
+
+		ArraySize bounds[maxSlices + 1];
+		for (UInt32 i = 0; i <= sliceCount; ++i)
+		{
+			bounds[i] = count * i / sliceCount;
+		}
+
+		std::thread threads[maxSlices];
+		for (UInt32 i = 1; i < sliceCount; ++i)
+		{
+			threads[i] = std::thread([=, &compare]() {
+				MergeSortRange(elements + bounds[i], scratch + bounds[i],
+					bounds[i + 1] - bounds[i], compare);
+			});
+		}
+		MergeSortRange(elements, scratch, bounds[1], compare);
+		for (UInt32 i = 1; i < sliceCount; ++i)
+		{
+			threads[i].join();
+		}
+
+		/*
+		Each round merges neighbouring pairs of sorted spans, one pair per
+		thread, ping-ponging between elements and scratch.
+		*/
+		T* source = elements;
+		T* destination = scratch;
+		for (UInt32 width = 1; width < sliceCount; width *= 2)
+		{
+			UInt32 pairCount = sliceCount / (2 * width);
+			for (UInt32 pair = 0; pair < pairCount; ++pair)
+			{
+				ArraySize start = bounds[pair * 2 * width];
+				ArraySize middle = bounds[pair * 2 * width + width];
+				ArraySize end = bounds[(pair + 1) * 2 * width];
+
+				threads[pair] = std::thread([=, &compare]() {
+					MergeRuns(source + start, middle - start, source + middle,
+						end - middle, destination + start, compare);
+				});
+			}
+			for (UInt32 pair = 0; pair < pairCount; ++pair)
+			{
+				threads[pair].join();
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != elements)
+		{
+			for (ArraySize i = 0; i < count; ++i)
+			{
+				elements[i] = std::move(source[i]);
+			}
+		}
+	}
+
+	/*
+	Sorts the elements of a Vector with a stable merge sort. See MergeSort()
+	on raw arrays.
+
+	@param vector - The Vector to sort.
+
+	@param compare - Returns whether its first argument belongs before its
+	                 second.
+
+	@param threadCount - The maximum number of threads to sort with, or 0 to
+	                     use every hardware thread.
+	*/
+	template <class T, class Compare = Less>
+	void MergeSort(Vector<T>& vector, Compare compare = Compare(),
+		UInt32 threadCount = 0)
+	{
+		if (vector.Length() > 1)
+		{
+			MergeSort(&vector[0], vector.Length(), compare, threadCount);
+		}
+	}
+
+	/*
+	Sorts the elements with a stable least significant digit radix sort, one
+	byte of the key per pass. Keys are pulled out of each element by
+	getKey and may be any integer or floating point type; passes where every
+	key shares the same byte are skipped. Elements are moved with memcpy, so
+	T must be trivially relocatable. Temporary storage for count elements is
+	taken from the MemoryManager for the duration of the call.
+
+	@param elements - The elements to sort.
+
+	@param count - The number of elements.
+
+	@param getKey - Returns the key to sort an element by.
+	*/
+	template <class T, class KeyFunction = Identity>
+	void RadixSort(T* elements, ArraySize count, KeyFunction getKey = KeyFunction())
+	{
+		static_assert(IsTriviallyRelocatable<T>::value,
+			"RadixSort moves elements with memcpy.");
+
+		typedef decltype(ToRadixKey(getKey(*elements))) Key;
+		constexpr UInt32 passCount = sizeof(Key);
+
+		if (count < 2)
+		{
+			return;
+		}
+
+		// Build the histograms for every pass in a single read of the keys.
+		ArraySize histograms[passCount][256] = {};
+		for (ArraySize i = 0; i < count; ++i)
+		{
+			UInt64 key = ToRadixKey(getKey(elements[i]));
+			for (UInt32 pass = 0; pass < passCount; ++pass)
+			{
+				++histograms[pass][(key >> (pass * 8)) & 0xFF];
+			}
+		}
+
+		UniqueHandle<T> scratchHandle = MemoryManager::AllocateArray<T>(count);
+		T* source = elements;
+		T* destination = scratchHandle.GetMemory();
+
+		for (UInt32 pass = 0; pass < passCount; ++pass)
+		{
+			ArraySize* histogram = histograms[pass];
+			UInt32 shift = pass * 8;
+
+			UInt64 firstKey = ToRadixKey(getKey(source[0]));
+			if (histogram[(firstKey >> shift) & 0xFF] == count)
+			{
+				continue;
+			}
+
+			ArraySize offset = 0;
+			for (UInt32 digit = 0; digit < 256; ++digit)
+			{
+				ArraySize digitCount = histogram[digit];
+				histogram[digit] = offset;
+				offset += digitCount;
+			}
+
+			for (ArraySize i = 0; i < count; ++i)
+			{
+				UInt64 key = ToRadixKey(getKey(source[i]));
+				memcpy((void*)(destination + histogram[(key >> shift) & 0xFF]++),
+					(const void*)(source + i), sizeof(T));
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != elements)
+		{
+			memcpy((void*)elements, (const void*)source, count * sizeof(T));
+		}
+
+		/*
+		The scratch memory now holds stale copies of the elements, which must
+		not be destructed along with it.
+		*/
+		if constexpr (!std::is_trivially_copyable<T>::value)
+		{
+			memset((void*)scratchHandle.GetMemory(), 0, count * sizeof(T));
+		}
+	}
+
+	/*
+	Sorts the elements of a Vector with a stable radix sort. See RadixSort()
+	on raw arrays.
+
+	@param vector - The Vector to sort.
+
+	@param getKey - Returns the key to sort an element by.
+	*/
+	template <class T, class KeyFunction = Identity>
+	void RadixSort(Vector<T>& vector, KeyFunction getKey = KeyFunction())
+	{
+		if (vector.Length() > 1)
+		{
+			RadixSort(&vector[0], vector.Length(), getKey);
+		}
+	}
+}
\ No newline at end of file
@@ -3,7 +3,7 @@ Used to manage C-Strings and provide utility functions and operations around
 such strings.
 @file String.cpp
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #include "String.h"
@@ -20,6 +20,7 @@ namespace Soul
 		m_Capacity(8),
 		m_CString(MemoryManager::AllocateArray<char>(m_Capacity))
 	{
+		m_CString[0] = '\0';
 	}
 
 	String::String(const char* string) :
@@ -107,48 +108,27 @@ namespace Soul
 		return std::move(tempString);
 	}
 
-	bool String::operator==(const String& otherString)
+	bool String::operator==(const String& otherString) const
 	{
 		if (otherString.Length() != m_Length)
 		{
 			return false;
 		}
 
-		for (Index i = 0; i < m_Length; i++)
-		{
-			if (otherString[i] != m_CString[i])
-			{
-				return false;
-			}
-		}
-
-		return true;
+		return memcmp(otherString.GetCString(), GetCString(), m_Length) == 0;
 	}
 
-	bool String::operator==(const char* string)
+	bool String::operator==(const char* string) const
 	{
-		if (strlen(string) != m_Length)
-		{
-			return false;
-		}
-
-		for (Index i = 0; i < m_Length; i++)
-		{
-			if (string[i] != m_CString[i])
-			{
-				return false;
-			}
-		}
-
-		return true;
+		return strcmp(string, GetCString()) == 0;
 	}
 
-	bool String::operator!=(const String& otherString)
+	bool String::operator!=(const String& otherString) const
 	{
 		return !operator==(otherString);
 	}
 
-	bool String::operator!=(const char* string)
+	bool String::operator!=(const char* string) const
 	{
 		return !operator==(string);
 	}
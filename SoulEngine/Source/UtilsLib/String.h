@@ -3,13 +3,15 @@ Used to manage C-Strings and provide utility functions and operations around
 such strings.
 @file String.h
 @author Jacob Peterson
-@edited 4/21/21
+@edited 10/19/26
 */
 
 #pragma once
 
 #include <Memory/UniqueHandle.h>
 #include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Hash.h>
+#include <UtilsLib/TypeTraits.h>
 
 namespace Soul
 {
@@ -26,10 +28,10 @@ namespace Soul
 		String& operator=(const String& otherString);
 		String operator+(const char* string);
 		String operator+(const String& otherString);
-		bool operator==(const String& otherString);
-		bool operator==(const char* string);
-		bool operator!=(const String& otherString);
-		bool operator!=(const char* string);
+		bool operator==(const String& otherString) const;
+		bool operator==(const char* string) const;
+		bool operator!=(const String& otherString) const;
+		bool operator!=(const char* string) const;
 		char& operator[](Index index);
 		const char& operator[](Index index) const;
 		operator const char*() const;
@@ -86,4 +88,16 @@ namespace Soul
 		ArraySize m_Capacity; // Capacity of m_CString, including null terminator
 		UniqueHandle<char> m_CString; // Handle to the C-String
 	};
+
+	template <>
+	struct IsTriviallyRelocatable<String> : std::true_type {};
+
+	template <>
+	struct Hash<String>
+	{
+		UInt64 operator()(const String& string) const
+		{
+			return HashBytes(string.GetCString(), string.Length());
+		}
+	};
 }
\ No newline at end of file
@@ -0,0 +1,473 @@
+/*
+Lock-free FIFO containers for passing elements between threads.
+@file ThreadSafeQueue.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <Memory/MemoryManager.h>
+#include <Memory/UniqueHandle.h>
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Macros.h>
+#include <UtilsLib/Maths/Functions.h>
+
+namespace Soul
+{
+	/*
+	Size of a cache line on the platforms we target. Indices written by
+	different threads are kept at least this far apart so they never share a
+	line.
+	*/
+	constexpr PtrSize CacheLineSize = 64;
+
+	/*
+	A bounded, lock-free FIFO queue for exactly one producer thread and one
+	consumer thread. The capacity is rounded up to a power of two and the
+	element buffer is allocated through the MemoryManager and pinned so the
+	defragmenter never moves it while other threads are using it.
+
+	The MemoryManager is not thread-safe, so the queue must be constructed and
+	destroyed on the thread that owns the MemoryManager. The queue must be
+	placed on a CacheLineSize boundary so its indices don't share a cache line
+	with neighbouring data; the stack and new take care of this, but
+	MemoryManager blocks aren't aligned.
+	*/
+	template <class T>
+	class alignas(CacheLineSize) SPSCQueue
+	{
+	public:
+		/*
+		@param capacity - Number of element slots. Rounded up to the next
+		                  power of two.
+		*/
+		SPSCQueue(ArraySize capacity);
+
+		/*
+		Adds the provided element to the back of the queue. Must only be called
+		from the producer thread.
+
+		@param element - The element to be added to the back of the queue.
+
+		@return Whether there was room for the element.
+		*/
+		bool TryPush(const T& element);
+
+		/*
+		Adds the provided element to the back of the queue. Must only be called
+		from the producer thread.
+
+		@param element - The element to be added to the back of the queue.
+
+		@return Whether there was room for the element.
+		*/
+		bool TryPush(T&& element);
+
+		/*
+		Removes the element at the front of the queue. Must only be called from
+		the consumer thread.
+
+		@param elementOut - Receives the element at the front of the queue.
+
+		@return Whether there was an element to remove.
+		*/
+		bool TryPop(T& elementOut);
+
+		/*
+		Gets the maximum number of elements that can be stored in this queue.
+
+		@return ArraySize containing the maximum queue capacity.
+		*/
+		ArraySize GetCapacity() const;
+
+		/*
+		Gets an estimate of the number of elements in this queue. The value may
+		already be stale by the time it is returned.
+
+		@return ArraySize containing the approximate number of elements.
+		*/
+		ArraySize GetLength() const;
+
+		SPSCQueue() = delete;
+		SPSCQueue(const SPSCQueue<T>&) = delete;
+		SPSCQueue<T>& operator=(const SPSCQueue<T>&) = delete;
+
+	private:
+		/*
+		Reserves the slot at the back of the queue.
+
+		@return Pointer to the reserved slot, or nullptr if the queue is full.
+		*/
+		T* BeginPush();
+
+	private:
+		UniqueHandle<T> m_Memory; // Handle to the element buffer.
+		T* m_Elements; // Pinned pointer into m_Memory.
+		ArraySize m_Mask; // Capacity - 1, used to wrap indices.
+		Byte m_ProducerPadding[CacheLineSize];
+
+		std::atomic<ArraySize> m_Tail; // Next slot to write. Written by producer.
+		ArraySize m_CachedHead; // Producer's last view of m_Head.
+		Byte m_ConsumerPadding[CacheLineSize];
+
+		std::atomic<ArraySize> m_Head; // Next slot to read. Written by consumer.
+		ArraySize m_CachedTail; // Consumer's last view of m_Tail.
+		Byte m_EndPadding[CacheLineSize];
+	};
+
+	/*
+	A bounded, lock-free FIFO queue that any number of threads may push to and
+	pop from concurrently. Each slot carries a sequence number that tells
+	producers and consumers whose turn it is, so the only contended writes are
+	the compare-and-swaps on the head and tail counters.
+
+	The MemoryManager is not thread-safe, so the queue must be constructed and
+	destroyed on the thread that owns the MemoryManager. Like SPSCQueue, the
+	queue must be placed on a CacheLineSize boundary.
+	*/
+	template <class T>
+	class alignas(CacheLineSize) MPMCQueue
+	{
+	public:
+		/*
+		@param capacity - Number of element slots. Rounded up to the next
+		                  power of two, and at least 2.
+		*/
+		MPMCQueue(ArraySize capacity);
+
+		~MPMCQueue();
+
+		/*
+		Adds the provided element to the back of the queue.
+
+		@param element - The element to be added to the back of the queue.
+
+		@return Whether there was room for the element.
+		*/
+		bool TryPush(const T& element);
+
+		/*
+		Adds the provided element to the back of the queue.
+
+		@param element - The element to be added to the back of the queue.
+
+		@return Whether there was room for the element.
+		*/
+		bool TryPush(T&& element);
+
+		/*
+		Removes the element at the front of the queue.
+
+		@param elementOut - Receives the element at the front of the queue.
+
+		@return Whether there was an element to remove.
+		*/
+		bool TryPop(T& elementOut);
+
+		/*
+		Gets the maximum number of elements that can be stored in this queue.
+
+		@return ArraySize containing the maximum queue capacity.
+		*/
+		ArraySize GetCapacity() const;
+
+		MPMCQueue() = delete;
+		MPMCQueue(const MPMCQueue<T>&) = delete;
+		MPMCQueue<T>& operator=(const MPMCQueue<T>&) = delete;
+
+	private:
+		struct Cell
+		{
+			std::atomic<ArraySize> sequence; // Which lap of the buffer this cell is ready for.
+			T element; // The stored element.
+		};
+
+		/*
+		Claims the cell at the back of the queue.
+
+		@param position - Receives the claimed queue position.
+
+		@return Pointer to the claimed cell, or nullptr if the queue is full.
+		*/
+		Cell* BeginPush(ArraySize& position);
+
+	private:
+		UniqueHandle<Byte> m_Memory; // Handle to the over-allocated cell buffer.
+		Cell* m_Cells; // Pinned pointer to the first aligned cell in m_Memory.
+		ArraySize m_Mask; // Capacity - 1, used to wrap indices.
+		Byte m_TailPadding[CacheLineSize];
+
+		std::atomic<ArraySize> m_Tail; // Next position to push to.
+		Byte m_HeadPadding[CacheLineSize];
+
+		std::atomic<ArraySize> m_Head; // Next position to pop from.
+		Byte m_EndPadding[CacheLineSize];
+	};
+
+	template <class T>
+	SPSCQueue<T>::SPSCQueue(ArraySize capacity) :
+		m_Memory(MemoryManager::AllocateArray<T>(NextPowerOfTwo(capacity))),
+		m_Elements(nullptr),
+		m_Mask(NextPowerOfTwo(capacity) - 1),
+		m_Tail(0),
+		m_CachedHead(0),
+		m_Head(0),
+		m_CachedTail(0)
+	{
+		Assert(((PtrSize)this & (CacheLineSize - 1)) == 0);
+
+		m_Memory.SetImmovable(true);
+		m_Elements = m_Memory.GetMemory();
+	}
+
+	template <class T>
+	bool SPSCQueue<T>::TryPush(const T& element)
+	{
+		T* slot = BeginPush();
+		if (!slot)
+		{
+			return false;
+		}
+
+		*slot = element;
+		m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1,
+			std::memory_order_release);
+
+		return true;
+	}
+
+	template <class T>
+	bool SPSCQueue<T>::TryPush(T&& element)
+	{
+		T* slot = BeginPush();
+		if (!slot)
+		{
+			return false;
+		}
+
+		*slot = std::move(element);
+		m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1,
+			std::memory_order_release);
+
+		return true;
+	}
+
+	template <class T>
+	bool SPSCQueue<T>::TryPop(T& elementOut)
+	{
+		ArraySize head = m_Head.load(std::memory_order_relaxed);
+
+		/*
+		Only touch the producer's cache line when our cached view says the
+		queue is empty.
+		*/
+		if (head == m_CachedTail)
+		{
+			m_CachedTail = m_Tail.load(std::memory_order_acquire);
+			if (head == m_CachedTail)
+			{
+				return false;
+			}
+		}
+
+		elementOut = std::move(m_Elements[head & m_Mask]);
+		m_Head.store(head + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template <class T>
+	ArraySize SPSCQueue<T>::GetCapacity() const
+	{
+		return m_Mask + 1;
+	}
+
+	template <class T>
+	ArraySize SPSCQueue<T>::GetLength() const
+	{
+		return m_Tail.load(std::memory_order_acquire) -
+			m_Head.load(std::memory_order_acquire);
+	}
+
+	template <class T>
+	T* SPSCQueue<T>::BeginPush()
+	{
+		ArraySize tail = m_Tail.load(std::memory_order_relaxed);
+
+		/*
+		Only touch the consumer's cache line when our cached view says the
+		queue is full.
+		*/
+		if (tail - m_CachedHead > m_Mask)
+		{
+			m_CachedHead = m_Head.load(std::memory_order_acquire);
+			if (tail - m_CachedHead > m_Mask)
+			{
+				return nullptr;
+			}
+		}
+
+		return m_Elements + (tail & m_Mask);
+	}
+
+	template <class T>
+	MPMCQueue<T>::MPMCQueue(ArraySize capacity) :
+		m_Memory(),
+		m_Cells(nullptr),
+		m_Mask(NextPowerOfTwo(capacity < 2 ? 2 : capacity) - 1),
+		m_Tail(0),
+		m_Head(0)
+	{
+		Assert(((PtrSize)this & (CacheLineSize - 1)) == 0);
+
+		/*
+		MemoryManager blocks aren't aligned, so over-allocate, pin the block
+		and align the cells within it. Otherwise a sequence number could
+		straddle two cache lines and every atomic on it would lock the bus.
+		*/
+		ArraySize cellBytes = (m_Mask + 1) * sizeof(Cell);
+		m_Memory = MemoryManager::AllocateArray<Byte>(cellBytes + CacheLineSize - 1);
+		m_Memory.SetImmovable(true);
+
+		PtrSize start = (PtrSize)m_Memory.GetMemory();
+		m_Cells = (Cell*)((start + CacheLineSize - 1) & ~(CacheLineSize - 1));
+
+		// Elements are assigned into, so they start out zeroed like AllocateArray's.
+		memset(m_Cells, 0, cellBytes);
+		for (ArraySize i = 0; i <= m_Mask; ++i)
+		{
+			m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	template <class T>
+	MPMCQueue<T>::~MPMCQueue()
+	{
+		// The cells live in a byte buffer, so the MemoryManager won't destruct them.
+		if constexpr (!std::is_trivially_destructible<T>::value)
+		{
+			for (ArraySize i = 0; i <= m_Mask; ++i)
+			{
+				m_Cells[i].element.~T();
+			}
+		}
+	}
+
+	template <class T>
+	bool MPMCQueue<T>::TryPush(const T& element)
+	{
+		ArraySize position;
+		Cell* cell = BeginPush(position);
+		if (!cell)
+		{
+			return false;
+		}
+
+		cell->element = element;
+		cell->sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template <class T>
+	bool MPMCQueue<T>::TryPush(T&& element)
+	{
+		ArraySize position;
+		Cell* cell = BeginPush(position);
+		if (!cell)
+		{
+			return false;
+		}
+
+		cell->element = std::move(element);
+		cell->sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template <class T>
+	bool MPMCQueue<T>::TryPop(T& elementOut)
+	{
+		ArraySize position = m_Head.load(std::memory_order_relaxed);
+		Cell* cell;
+
+		while (true)
+		{
+			cell = m_Cells + (position & m_Mask);
+			ArraySize sequence = cell->sequence.load(std::memory_order_acquire);
+			PtrSize difference = sequence - (position + 1);
+
+			/*
+			The cell has been filled for this lap, try to claim it. Otherwise
+			either the queue is empty, or another consumer beat us to it.
+			*/
+			if (difference == 0)
+			{
+				if (m_Head.compare_exchange_weak(position, position + 1,
+					std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if ((Int64)difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = m_Head.load(std::memory_order_relaxed);
+			}
+		}
+
+		elementOut = std::move(cell->element);
+		cell->sequence.store(position + m_Mask + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template <class T>
+	ArraySize MPMCQueue<T>::GetCapacity() const
+	{
+		return m_Mask + 1;
+	}
+
+	template <class T>
+	typename MPMCQueue<T>::Cell* MPMCQueue<T>::BeginPush(ArraySize& position)
+	{
+		position = m_Tail.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			Cell* cell = m_Cells + (position & m_Mask);
+			ArraySize sequence = cell->sequence.load(std::memory_order_acquire);
+			PtrSize difference = sequence - position;
+
+			/*
+			The cell is free for this lap, try to claim it. Otherwise either
+			the queue is full, or another producer beat us to it.
+			*/
+			if (difference == 0)
+			{
+				if (m_Tail.compare_exchange_weak(position, position + 1,
+					std::memory_order_relaxed))
+				{
+					return cell;
+				}
+			}
+			else if ((Int64)difference < 0)
+			{
+				return nullptr;
+			}
+			else
+			{
+				position = m_Tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+}
\ No newline at end of file
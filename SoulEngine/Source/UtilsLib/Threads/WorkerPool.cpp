@@ -0,0 +1,122 @@
+/*
+A fixed set of worker threads that run batches of jobs in parallel.
+@file WorkerPool.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "WorkerPool.h"
+
+#include <UtilsLib/Macros.h>
+
+namespace Soul
+{
+	WorkerPool::WorkerPool(UInt32 threadCount) :
+		m_ThreadCount(threadCount),
+		m_JobCount(0),
+		m_Generation(0),
+		m_BusyWorkers(0),
+		m_IsStopping(false),
+		m_NextJob(0)
+	{
+		Assert(threadCount <= MaxThreads);
+
+		for (UInt32 i = 0; i < m_ThreadCount; ++i)
+		{
+			m_Threads[i] = std::thread([this]() { WorkerLoop(); });
+		}
+	}
+
+	WorkerPool::~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_IsStopping = true;
+		}
+		m_WorkReady.notify_all();
+
+		for (UInt32 i = 0; i < m_ThreadCount; ++i)
+		{
+			m_Threads[i].join();
+		}
+	}
+
+	void WorkerPool::Run(ArraySize jobCount, Job job)
+	{
+		if (jobCount == 0)
+		{
+			return;
+		}
+
+		{
+			/*
+			A worker that woke up late for the last Run() may still be looking
+			for jobs, so let it leave before the counter is reset.
+			*/
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_WorkDone.wait(lock, [this]() { return m_BusyWorkers == 0; });
+
+			m_Job = job;
+			m_JobCount = jobCount;
+			m_NextJob.store(0, std::memory_order_relaxed);
+			++m_Generation;
+		}
+		m_WorkReady.notify_all();
+
+		RunJobs(job, jobCount);
+
+		// Every job has been claimed, wait for the workers still running one.
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_WorkDone.wait(lock, [this]() { return m_BusyWorkers == 0; });
+	}
+
+	UInt32 WorkerPool::GetThreadCount() const
+	{
+		return m_ThreadCount;
+	}
+
+	void WorkerPool::WorkerLoop()
+	{
+		UInt32 seenGeneration = 0;
+
+		while (true)
+		{
+			Job job;
+			ArraySize jobCount;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_WorkReady.wait(lock, [this, seenGeneration]() {
+					return m_IsStopping || m_Generation != seenGeneration;
+				});
+
+				if (m_IsStopping)
+				{
+					return;
+				}
+
+				seenGeneration = m_Generation;
+				job = m_Job;
+				jobCount = m_JobCount;
+				++m_BusyWorkers;
+			}
+
+			RunJobs(job, jobCount);
+
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (--m_BusyWorkers == 0)
+			{
+				m_WorkDone.notify_all();
+			}
+		}
+	}
+
+	void WorkerPool::RunJobs(Job job, ArraySize jobCount)
+	{
+		ArraySize jobIndex = m_NextJob.fetch_add(1, std::memory_order_relaxed);
+		while (jobIndex < jobCount)
+		{
+			job(jobIndex);
+			jobIndex = m_NextJob.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
\ No newline at end of file
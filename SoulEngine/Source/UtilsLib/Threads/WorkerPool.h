@@ -0,0 +1,101 @@
+/*
+A fixed set of worker threads that run batches of jobs in parallel.
+@file WorkerPool.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <UtilsLib/CommonTypes.h>
+#include <UtilsLib/Delegate.h>
+#include <UtilsLib/Threads/ThreadSafeQueue.h>
+
+namespace Soul
+{
+	/*
+	Keeps a handful of threads asleep until there is work for them, so
+	per-frame parallel work doesn't pay for creating threads. Run() hands out
+	job indices through a shared counter, works on them itself alongside the
+	workers, and returns once every job has finished.
+
+	Jobs must not use the MemoryManager, which isn't thread-safe. The pool
+	holds a mutex and atomics, so it must be placed in memory aligned to
+	CacheLineSize rather than allocated straight from the MemoryManager.
+	*/
+	class alignas(CacheLineSize) WorkerPool
+	{
+	public:
+		typedef Delegate<void(ArraySize)> Job;
+
+		/*
+		Maximum number of worker threads in a pool.
+		*/
+		static constexpr UInt32 MaxThreads = 16;
+
+		/*
+		@param threadCount - Number of worker threads to start, not counting
+		                     the thread that calls Run(). At most MaxThreads.
+		*/
+		WorkerPool(UInt32 threadCount);
+
+		~WorkerPool();
+
+		/*
+		Calls the job once for every index in [0, jobCount), spread across the
+		workers and the calling thread, and waits for all of them to finish.
+		Must only be called from one thread at a time.
+
+		@param jobCount - Number of times to call the job.
+
+		@param job - Callable taking (ArraySize jobIndex).
+		*/
+		void Run(ArraySize jobCount, Job job);
+
+		/*
+		Gets the number of worker threads in this pool.
+
+		@return UInt32 containing the number of worker threads.
+		*/
+		UInt32 GetThreadCount() const;
+
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+	private:
+		/*
+		Waits for work and runs jobs until the pool is destroyed.
+		*/
+		void WorkerLoop();
+
+		/*
+		Claims and runs jobs until there are none left.
+
+		@param job - The job to run.
+
+		@param jobCount - Number of jobs in this Run().
+		*/
+		void RunJobs(Job job, ArraySize jobCount);
+
+	private:
+		std::thread m_Threads[MaxThreads]; // The worker threads.
+		UInt32 m_ThreadCount; // Number of threads in m_Threads.
+
+		std::mutex m_Mutex; // Guards everything below except m_NextJob.
+		std::condition_variable m_WorkReady; // Signaled when a Run() starts or the pool stops.
+		std::condition_variable m_WorkDone; // Signaled when the last busy worker finishes.
+		Job m_Job; // The current Run()'s job.
+		ArraySize m_JobCount; // The current Run()'s number of jobs.
+		UInt32 m_Generation; // Incremented by every Run().
+		UInt32 m_BusyWorkers; // Number of workers inside RunJobs().
+		bool m_IsStopping; // Whether the workers should exit.
+		Byte m_Padding[CacheLineSize];
+
+		std::atomic<ArraySize> m_NextJob; // Next job index to claim.
+	};
+}
\ No newline at end of file
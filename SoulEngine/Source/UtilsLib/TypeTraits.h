@@ -0,0 +1,24 @@
+/*
+Contains type traits used by the engine's containers.
+@file TypeTraits.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <type_traits>
+
+namespace Soul
+{
+	/*
+	Whether an object of type T can be moved to a new address with a plain
+	memcpy, leaving the old bytes to be discarded without running the
+	destructor. Trivially copyable types always qualify. Types that own
+	memory only through a pointer that nothing points back at (like
+	UniqueHandle or String) also qualify, and opt in by specializing this
+	trait next to their declaration.
+	*/
+	template <class T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+}
\ No newline at end of file
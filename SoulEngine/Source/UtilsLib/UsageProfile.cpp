@@ -0,0 +1,155 @@
+/*
+Records peak engine memory usage so the next run can be sized from it.
+@file UsageProfile.cpp
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#include "UsageProfile.h"
+
+#include <Events/EventBus.h>
+#include <UtilsLib/Logger.h>
+
+#include <Windows.h>
+
+namespace Soul
+{
+	/*
+	On-disk layout of a profile. Bump the version whenever this changes.
+	*/
+	struct UsageProfileData
+	{
+		UInt32 version;
+		UInt64 peakArenaBytes;
+		UInt64 peakVolatileBytes;
+		UInt64 peakHandleCount;
+		UInt64 peakEventCount;
+	};
+
+	static const UInt32 UsageProfileVersion = 1;
+
+	UsageProfile::UsageProfile() :
+		m_PeakArenaBytes(0),
+		m_PeakVolatileBytes(0),
+		m_PeakHandleCount(0),
+		m_PeakEventCount(0),
+		m_IsLoaded(false)
+	{
+
+	}
+
+	bool UsageProfile::Load(const char* filePath)
+	{
+		HANDLE fileHandle = CreateFileA(filePath, GENERIC_READ, 0, 0, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, NULL);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		UsageProfileData data;
+		DWORD bytesRead = 0;
+		BOOL didRead = ReadFile(fileHandle, &data, sizeof(data), &bytesRead, 0);
+		CloseHandle(fileHandle);
+
+		if (!didRead || bytesRead != sizeof(data) || data.version != UsageProfileVersion)
+		{
+			SoulLogWarning("Ignoring invalid usage profile %s.", filePath);
+			return false;
+		}
+
+		m_PeakArenaBytes = (ByteCount)data.peakArenaBytes;
+		m_PeakVolatileBytes = (ByteCount)data.peakVolatileBytes;
+		m_PeakHandleCount = (HandleTableSize)data.peakHandleCount;
+		m_PeakEventCount = (ArraySize)data.peakEventCount;
+		m_IsLoaded = true;
+
+		return true;
+	}
+
+	void UsageProfile::Save(const char* filePath) const
+	{
+		HANDLE fileHandle = CreateFileA(filePath, GENERIC_WRITE, 0, 0, CREATE_ALWAYS,
+			FILE_ATTRIBUTE_NORMAL, NULL);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			SoulLogWarning("Failed to save usage profile %s.", filePath);
+			return;
+		}
+
+		UsageProfileData data;
+		memset(&data, 0, sizeof(data));
+		data.version = UsageProfileVersion;
+		data.peakArenaBytes = m_PeakArenaBytes;
+		data.peakVolatileBytes = m_PeakVolatileBytes;
+		data.peakHandleCount = m_PeakHandleCount;
+		data.peakEventCount = m_PeakEventCount;
+
+		DWORD bytesWritten;
+		WriteFile(fileHandle, &data, sizeof(data), &bytesWritten, 0);
+		CloseHandle(fileHandle);
+	}
+
+	void UsageProfile::Capture()
+	{
+		m_PeakArenaBytes = MemoryManager::GetPeakAllocatedBytes();
+		m_PeakVolatileBytes = MemoryManager::GetPeakVolatileBytes();
+		m_PeakHandleCount = MemoryManager::GetPeakHandleCount();
+		m_PeakEventCount = EventBus::GetPeakEventCount();
+		m_IsLoaded = true;
+	}
+
+	ByteCount UsageProfile::GetArenaByteSize() const
+	{
+		if (!m_IsLoaded)
+		{
+			return Gigabytes(1);
+		}
+
+		/*
+		Double the peak to leave room for fragmentation, plus the handle
+		table. MemoryManager::StartUp() takes the table out of the byte size
+		it is given and then places it inside what is left, so the table has
+		to be paid for twice for the arena to keep the full size.
+		*/
+		ByteCount arenaBytes = m_PeakArenaBytes * 2;
+		if (arenaBytes < Megabytes(16))
+		{
+			arenaBytes = Megabytes(16);
+		}
+		return arenaBytes + sizeof(Handle) * GetHandleTableLength() * 2;
+	}
+
+	ByteCount UsageProfile::GetVolatileByteSize() const
+	{
+		if (!m_IsLoaded)
+		{
+			return Megabytes(8);
+		}
+
+		ByteCount volatileBytes = m_PeakVolatileBytes * 2;
+		return volatileBytes < Megabytes(1) ? Megabytes(1) : volatileBytes;
+	}
+
+	HandleTableSize UsageProfile::GetHandleTableLength() const
+	{
+		if (!m_IsLoaded)
+		{
+			return 4096;
+		}
+
+		HandleTableSize handleCount = m_PeakHandleCount * 2;
+		return handleCount < 512 ? 512 : handleCount;
+	}
+
+	ArraySize UsageProfile::GetEventCount() const
+	{
+		if (!m_IsLoaded)
+		{
+			return 32;
+		}
+
+		ArraySize eventCount = m_PeakEventCount * 2;
+		return eventCount < 32 ? 32 : eventCount;
+	}
+}
\ No newline at end of file
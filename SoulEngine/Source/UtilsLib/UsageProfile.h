@@ -0,0 +1,87 @@
+/*
+Records peak engine memory usage so the next run can be sized from it.
+@file UsageProfile.h
+@author Jacob Peterson
+@edited 10/19/26
+*/
+
+#pragma once
+
+#include <Memory/MemoryManager.h>
+#include <UtilsLib/CommonTypes.h>
+
+namespace Soul
+{
+	/*
+	Holds the high-water marks of the MemoryManager and EventBus from a run of
+	the engine. Capture() should be called just before the engine shuts down,
+	and the profile saved with Save(). On the next run, Load() the profile
+	before starting up and use the Get...() functions to size each system.
+
+	Each size is the recorded peak with headroom, but never less than a small
+	minimum. If no profile could be loaded, generous defaults are used instead.
+	*/
+	class UsageProfile
+	{
+	public:
+		UsageProfile();
+
+		/*
+		Reads a previously saved profile.
+
+		@param filePath - Path of the profile to read.
+
+		@return True if a valid profile was read, false if the defaults are
+		        still in use.
+		*/
+		bool Load(const char* filePath);
+
+		/*
+		Writes this profile so it can be loaded on the next run.
+
+		@param filePath - Path of the file to write the profile to.
+		*/
+		void Save(const char* filePath) const;
+
+		/*
+		Records the current high-water marks of the MemoryManager and EventBus.
+		Both need to still be running.
+		*/
+		void Capture();
+
+		/*
+		Returns the number of bytes to reserve for the MemoryManager's arena.
+
+		@return ByteCount containing the arena size.
+		*/
+		ByteCount GetArenaByteSize() const;
+
+		/*
+		Returns the number of bytes to reserve for volatile memory.
+
+		@return ByteCount containing the volatile memory size.
+		*/
+		ByteCount GetVolatileByteSize() const;
+
+		/*
+		Returns the number of handles to reserve in the MemoryManager.
+
+		@return HandleTableSize containing the handle table length.
+		*/
+		HandleTableSize GetHandleTableLength() const;
+
+		/*
+		Returns the number of events the EventBus should be able to queue.
+
+		@return ArraySize containing the event queue capacity.
+		*/
+		ArraySize GetEventCount() const;
+
+	private:
+		ByteCount m_PeakArenaBytes; // Peak bytes allocated in the arena.
+		ByteCount m_PeakVolatileBytes; // Peak bytes used in volatile memory.
+		HandleTableSize m_PeakHandleCount; // Peak number of live handles.
+		ArraySize m_PeakEventCount; // Peak number of queued events.
+		bool m_IsLoaded; // Whether the peaks came from a previous run.
+	};
+}
\ No newline at end of file